@@ -0,0 +1,72 @@
+# Build time asset pipeline
+#
+# Converts the sources in assets/ into blobs that are pulled into flash through .incbin, together with
+# a small header holding the metadata. Every asset is its own custom command, so only the assets whose
+# source changed are converted again, and the header is only touched when the metadata changes.
+
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+set(ASSET_SCRIPT ${CMAKE_SOURCE_DIR}/scripts/asset_pipeline/assets.py)
+set(ASSET_CONVERTER ${CMAKE_SOURCE_DIR}/scripts/image_converter/converter.py)
+set(ASSET_OUTPUT_DIR ${CMAKE_BINARY_DIR}/generated/assets)
+
+# add_image_asset(<target> <name> <source> [RAW] [SIZE <width>x<height>])
+# Converts an image to RGB565, compressed unless RAW is given. SIZE is needed for raw and C source inputs.
+# The header is included as "assets/<name>.h".
+function(add_image_asset TARGET NAME SOURCE)
+    cmake_parse_arguments(ASSET "RAW" "SIZE" "" ${ARGN})
+
+    set(ASSET_ARGS)
+    if(ASSET_RAW)
+        list(APPEND ASSET_ARGS --raw)
+    endif()
+    if(ASSET_SIZE)
+        list(APPEND ASSET_ARGS --size ${ASSET_SIZE})
+    endif()
+
+    add_asset(${TARGET} ${NAME} ${SOURCE} image ${ASSET_ARGS})
+endfunction()
+
+# add_font_asset(<target> <name> <source> PIXELS <size> [CHARSET <characters>])
+# Rasterizes a TTF/OTF font into 8 bit coverage cells, printable ASCII unless CHARSET is given.
+# Needs Pillow on the build machine. The header is included as "assets/<name>.h".
+function(add_font_asset TARGET NAME SOURCE)
+    cmake_parse_arguments(ASSET "" "PIXELS;CHARSET" "" ${ARGN})
+
+    set(ASSET_ARGS --pixels ${ASSET_PIXELS})
+    if(DEFINED ASSET_CHARSET)
+        list(APPEND ASSET_ARGS --charset "${ASSET_CHARSET}")
+    endif()
+
+    add_asset(${TARGET} ${NAME} ${SOURCE} font ${ASSET_ARGS})
+endfunction()
+
+# Shared by the functions above
+function(add_asset TARGET NAME SOURCE KIND)
+    set(ASSET_STAMP ${ASSET_OUTPUT_DIR}/${NAME}.stamp)
+    set(ASSET_FILES
+        ${ASSET_OUTPUT_DIR}/${NAME}.h
+        ${ASSET_OUTPUT_DIR}/${NAME}.S
+        ${ASSET_OUTPUT_DIR}/${NAME}.bin
+    )
+
+    add_custom_command(
+        OUTPUT ${ASSET_STAMP}
+        BYPRODUCTS ${ASSET_FILES}
+        COMMAND ${Python3_EXECUTABLE} ${ASSET_SCRIPT} ${KIND} ${SOURCE} ${ASSET_OUTPUT_DIR} ${NAME} ${ARGN}
+        COMMAND ${CMAKE_COMMAND} -E touch ${ASSET_STAMP}
+        DEPENDS ${SOURCE} ${ASSET_SCRIPT} ${ASSET_CONVERTER}
+        COMMENT "Converting asset ${NAME}"
+        VERBATIM
+    )
+
+    # the assembler does not know the blob is pulled in, so tell CMake about it
+    set_source_files_properties(${ASSET_OUTPUT_DIR}/${NAME}.S PROPERTIES
+        GENERATED TRUE
+        OBJECT_DEPENDS "${ASSET_STAMP};${ASSET_OUTPUT_DIR}/${NAME}.bin"
+    )
+
+    add_custom_target(${TARGET}_${NAME}_asset DEPENDS ${ASSET_STAMP})
+    add_dependencies(${TARGET} ${TARGET}_${NAME}_asset)
+    target_sources(${TARGET} PRIVATE ${ASSET_OUTPUT_DIR}/${NAME}.S)
+endfunction()
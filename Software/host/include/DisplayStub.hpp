@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Screen.hpp"
+
+/**
+ * @brief What went out to the display so far
+ * @param frames the number of frames pushed
+ * @param writes the number of areas written
+ * @param pixels the number of pixels written
+*/
+struct DisplayStub_Stats
+{
+    unsigned int frames;
+    unsigned int writes;
+    unsigned long long pixels;
+};
+
+/**
+ * @brief Stands in for the display memory of the ST7789, the stubbed Screen writes into it
+ * @note The display memory is kept in the orientation of the frame buffer, one column per memory line
+*/
+class DisplayStub
+{
+public:
+    DisplayStub(unsigned int width, unsigned int height, bool mirrored);
+    ~DisplayStub();
+
+    void write(Screen_Rect rect, const unsigned short* pixels, unsigned int stride);
+    void setScrollArea(unsigned int top, unsigned int lines, unsigned int bottom);
+    void scroll(unsigned int line);
+    void endFrame();
+
+    void snapshot(unsigned short* pixels);
+    unsigned int getWidth();
+    unsigned int getHeight();
+    DisplayStub_Stats getStats();
+    void resetStats();
+
+    static DisplayStub* getInstance();
+private:
+    unsigned int width;
+    unsigned int height;
+    bool mirrored;
+    unsigned short* memory;
+    DisplayStub_Stats stats = {0};
+
+    unsigned int scrollTop = 0;
+    unsigned int scrollLines = 0;
+    unsigned int scrollLine = 0;
+
+    static DisplayStub* instance;
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+#define FAKE_INA219_PERIOD      4000000     // 4s for one round of the load profile
+#define FAKE_INA219_STEPS       4           // the source voltage steps through the usual PD voltages
+
+/**
+ * @brief Stands in for the INA219, with the same accessors the firmware reads
+ * @note The values follow a fixed profile over the clock, so every run sees the same samples:
+ * the voltage steps through 5, 9, 15 and 20V while the current ramps up and down with a spike on top
+*/
+class FakeINA219
+{
+public:
+    void getData();
+
+    int getVoltageMicro();
+    int getCurrentMicro();
+    int getPowerMicro();
+private:
+    int voltage = 0;
+    int current = 0;
+    int power = 0;
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief The clock time_us_32() and time_us_64() read on the host
+ * @note It only moves when told to, so every run renders the exact same frames
+*/
+class HostClock
+{
+public:
+    static void advance(uint64_t microseconds);
+    static uint64_t now();
+private:
+    static uint64_t time;
+};
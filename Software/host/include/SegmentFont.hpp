@@ -0,0 +1,38 @@
+#pragma once
+
+#include "GlyphCache.hpp"
+
+#define SEGMENT_FONT_HEIGHT     48      // line height, like RobotoMono48
+#define SEGMENT_FONT_WIDTH      28      // advance of every glyph but the dot
+#define SEGMENT_FONT_DOT_WIDTH  12
+#define SEGMENT_FONT_MARGIN     4       // empty pixels left and right of the strokes
+#define SEGMENT_FONT_TOP        6       // the first row of the strokes
+#define SEGMENT_FONT_BOTTOM     41      // the baseline
+#define SEGMENT_FONT_STROKE     5.0f    // stroke width in pixels
+#define SEGMENT_FONT_MAX_LINES  7
+#define SEGMENT_FONT_SIZE       32768   // bytes for the whole font asset
+
+/**
+ * @brief A line of a glyph, from 0 to 1 across the area between the margins and from the top to the baseline
+*/
+struct SegmentFont_Line
+{
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+};
+
+/**
+ * @brief Stands in for the readout font on the host, where PicoGFX and the TTF are not around
+ * @note The readout glyphs are drawn as anti-aliased strokes and packed into a font asset,
+ * which the glyph cache loads like the one from the asset pipeline
+*/
+class SegmentFont
+{
+public:
+    static const unsigned char* build(const char* characters);
+private:
+    static unsigned int glyph(char character, SegmentFont_Line* lines);
+    static unsigned char coverage(const SegmentFont_Line* lines, unsigned int count, float x, float y, float width);
+};
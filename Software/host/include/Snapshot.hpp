@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+
+/**
+ * @brief Writes frames to files and compares them with frames written earlier
+ * @note The pixels are RGB565, the files hold 8 bit RGB. PNGs are stored uncompressed, so there
+ * is nothing to link against.
+*/
+class Snapshot
+{
+public:
+    static bool writePPM(const char* path, const unsigned short* pixels, unsigned int width, unsigned int height);
+    static bool writePNG(const char* path, const unsigned short* pixels, unsigned int width, unsigned int height);
+    static int comparePPM(const char* path, const unsigned short* pixels, unsigned int width, unsigned int height);
+private:
+    static void toRGB(unsigned char* rgb, unsigned short pixel);
+    static uint32_t crc(uint32_t crc, const unsigned char* data, unsigned int length);
+    static void writeChunk(FILE* file, const char* type, const unsigned char* data, unsigned int length);
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdint.h>
+
+// Host stand-in, reports the system clock the firmware runs at
+enum clock_index
+{
+    clk_sys = 5,
+};
+
+static inline uint32_t clock_get_hz(enum clock_index clock)
+{
+    return 125000000;
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+// Host stand-in, the background is kept in RAM on the host
+#define FLASH_PAGE_SIZE     256
+#define FLASH_SECTOR_SIZE   4096
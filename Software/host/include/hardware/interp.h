@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+
+// Host stand-in for the interpolators. Only the register layout is there so the code builds,
+// nothing is computed, so the host always runs the plain loops (setInterpolator(false)).
+
+typedef struct
+{
+    volatile uint32_t accum[2];
+    volatile uint32_t base[3];
+    volatile uint32_t pop[3];
+    volatile uint32_t peek[3];
+    volatile uint32_t ctrl[2];
+    volatile uint32_t add_raw[2];
+    volatile uint32_t base01;
+} interp_hw_t;
+
+typedef struct
+{
+    uint32_t ctrl;
+} interp_config;
+
+typedef struct
+{
+    uint32_t accum[2];
+    uint32_t base[3];
+    uint32_t ctrl[2];
+} interp_hw_save_t;
+
+inline interp_hw_t interpHost[2];
+#define interp0 (&interpHost[0])
+#define interp1 (&interpHost[1])
+
+static inline interp_config interp_default_config() { return {0}; }
+static inline void interp_config_set_shift(interp_config* config, unsigned int shift) {}
+static inline void interp_config_set_mask(interp_config* config, unsigned int lsb, unsigned int msb) {}
+static inline void interp_config_set_add_raw(interp_config* config, bool add) {}
+static inline void interp_config_set_blend(interp_config* config, bool blend) {}
+static inline void interp_config_set_signed(interp_config* config, bool sign) {}
+static inline void interp_config_set_cross_input(interp_config* config, bool cross) {}
+static inline void interp_config_set_cross_result(interp_config* config, bool cross) {}
+static inline void interp_config_set_clamp(interp_config* config, bool clamp) {}
+static inline void interp_set_config(interp_hw_t* interp, unsigned int lane, interp_config* config) {}
+static inline void interp_set_base(interp_hw_t* interp, unsigned int lane, uint32_t value) { interp->base[lane] = value; }
+static inline void interp_save(interp_hw_t* interp, interp_hw_save_t* saver) {}
+static inline void interp_restore(interp_hw_t* interp, interp_hw_save_t* saver) {}
@@ -0,0 +1,5 @@
+#pragma once
+
+// Host stand-in, the display is never driven through PIO on the host
+typedef struct pio_hw pio_hw_t;
+typedef pio_hw_t* PIO;
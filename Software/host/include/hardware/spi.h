@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stand-in, the display is never driven over SPI on the host
+typedef struct spi_inst spi_inst_t;
@@ -0,0 +1,3 @@
+#pragma once
+
+// Host stand-in, nothing on the host goes through XIP
@@ -0,0 +1,26 @@
+#pragma once
+
+// Host stand-in for the Pico SDK, just enough for the drawing code to build on Linux.
+// The time functions run off the virtual clock of the renderer, see HostClock.hpp.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+
+#ifndef MIN
+#define MIN(a, b) ((b) > (a) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+#define __not_in_flash_func(function)   function
+#define __time_critical_func(function)  function
+#define __scratch_x(name)
+#define __scratch_y(name)
+
+uint32_t time_us_32();
+uint64_t time_us_64();
+
+static inline void tight_loop_contents() {}
@@ -0,0 +1,102 @@
+// This is a header guard. It prevents the file from being included more than once.
+#pragma once
+
+/***
+ *      _                          _   
+ *     | |    __ _ _   _  ___  _   _| |_ 
+ *     | |   / _` | | | |/ _ \| | | | __|
+ *     | |__| (_| | |_| | (_) | |_| | |_ 
+ *     |_____\__,_|\__, |\___/ \__,_|\__|
+ *                 |___/                 
+ */
+
+// Keep these in sync with include/main.h, the host renders the same layout as the device
+#define DISP_WIDTH              172
+#define DISP_HEIGHT             320
+#define DISP_STRIP_HEIGHT       16
+
+#define READOUT_GLYPHS          "0123456789.-mVAW"
+#define READOUT_COLOR           0xffff
+#define READOUT_POWER_SPACING   10
+#define READOUT_FPS_X           230
+#define READOUT_FPS_Y           10
+#define READOUT_FPS_HEIGHT      30
+
+#define PAGE_READOUT            0
+#define PAGE_GRAPH              1
+
+#define GRAPH_LABEL_WIDTH       88
+#define GRAPH_LABEL_SPACING     30
+#define GRAPH_LABEL_X           4
+#define GRAPH_LABEL_Y           10
+#define GRAPH_SERIES_VOLTAGE    0
+#define GRAPH_SERIES_CURRENT    1
+#define GRAPH_SERIES_POWER      2
+#define GRAPH_MIRRORED          true
+#define GRAPH_INTERVAL          100000
+#define GRAPH_COLOR_VOLTAGE     0xafe5
+#define GRAPH_COLOR_CURRENT     0xfa20
+#define GRAPH_COLOR_POWER       0xffff
+
+// The boot background, drawn with the gradient kernel since PicoGFX is not built on the host
+#define BACKGROUND_ANGLE        10
+#define BACKGROUND_FROM         0xfa20  // OrangeRed in RGB565
+#define BACKGROUND_TO           0xb5a8  // DarkYellow in RGB565
+
+
+
+/***
+ *      ____                _           
+ *     |  _ \ ___ _ __   __| | ___ _ __ 
+ *     | |_) / _ \ '_ \ / _` |/ _ \ '__|
+ *     |  _ <  __/ | | | (_| |  __/ |   
+ *     |_| \_\___|_| |_|\__,_|\___|_|   
+ *                                      
+ */
+
+#define RENDERER_FRAME_INTERVAL     33333   // 30 frames per second on the virtual clock, one sample per frame
+#define RENDERER_READOUT_FRAMES     90      // 3s of readout
+#define RENDERER_GRAPH_FRAMES       300     // 10s of graph, 100 columns
+#define RENDERER_KERNEL_ITERATIONS  20
+#define RENDERER_FORMAT_ITERATIONS  10000
+#define RENDERER_PATH_LENGTH        256
+
+// PicoGFX is not around for the labels either, each character is drawn as a block the size of a RobotoMono24 cell
+#define RENDERER_LABEL_ADVANCE      14
+#define RENDERER_LABEL_TOP          6
+#define RENDERER_LABEL_HEIGHT       17
+
+
+
+/***
+ *      ___            _           _           
+ *     |_ _|_ __   ___| |_   _  __| | ___  ___ 
+ *      | || '_ \ / __| | | | |/ _` |/ _ \/ __|
+ *      | || | | | (__| | |_| | (_| |  __/\__ \
+ *     |___|_| |_|\___|_|\__,_|\__,_|\___||___/
+ *                                             
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "Screen.hpp"
+#include "Background.hpp"
+#include "GlyphCache.hpp"
+#include "Graph.hpp"
+#include "Strip.hpp"
+#include "Kernels.hpp"
+#include "Formatter.hpp"
+#include "Widget.hpp"
+#include "Panel.hpp"
+#include "Label.hpp"
+#include "Readout.hpp"
+#include "Plot.hpp"
+#include "Pager.hpp"
+#include "DisplayStub.hpp"
+#include "FakeINA219.hpp"
+#include "HostClock.hpp"
+#include "SegmentFont.hpp"
+#include "Snapshot.hpp"
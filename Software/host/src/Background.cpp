@@ -0,0 +1,74 @@
+#include "Background.hpp"
+
+// Host version of the background, kept in RAM instead of flash. There is only ever one.
+static unsigned short* saved = nullptr;
+
+/**
+ * @brief Construct a new Background:: Background object
+ * @param frameBuffer the frame buffer the background is restored into
+ * @param width the width of the frame buffer in pixels
+ * @param height the height of the frame buffer in pixels
+ * @param flashOffset unused on the host
+*/
+Background::Background(unsigned short* frameBuffer, unsigned int width, unsigned int height, unsigned int flashOffset)
+{
+    this->frameBuffer = frameBuffer;
+    this->width = width;
+    this->height = height;
+    this->flashOffset = flashOffset;
+}
+
+/**
+ * @brief Initialize the background
+*/
+void Background::init()
+{
+    if(saved == nullptr)
+        saved = new unsigned short[this->width * this->height]();
+}
+
+/**
+ * @brief Remember the profiler, the host has no SysTick to profile with
+ * @param profiler the profiler of the loop
+ * @param stage the stage the restores would be charged to
+*/
+void Background::setProfiler(Profiler* profiler, unsigned int stage)
+{
+    this->profiler = profiler;
+    this->stage = stage;
+}
+
+/**
+ * @brief Save the current contents of the frame buffer as the background
+*/
+void Background::save()
+{
+    this->init();
+    memcpy(saved, this->frameBuffer, this->width * this->height * sizeof(unsigned short));
+}
+
+/**
+ * @brief Restore an area of the frame buffer from the background
+ * @param rect the area to restore
+*/
+void Background::restore(Screen_Rect rect)
+{
+    if(saved == nullptr || rect.x >= this->width || rect.y >= this->height)
+        return;
+
+    unsigned int columns = MIN(rect.width, this->width - rect.x);
+    unsigned int rows = MIN(rect.height, this->height - rect.y);
+    for(unsigned int row = 0; row < rows; row++)
+    {
+        unsigned int offset = (rect.y + row) * this->width + rect.x;
+        memcpy(&this->frameBuffer[offset], &saved[offset], columns * sizeof(unsigned short));
+    }
+}
+
+/**
+ * @brief Restore the entire frame buffer from the background
+*/
+void Background::restoreAll()
+{
+    this->restore({0, 0, this->width, this->height});
+}
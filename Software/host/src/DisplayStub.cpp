@@ -0,0 +1,139 @@
+#include "DisplayStub.hpp"
+
+DisplayStub* DisplayStub::instance = nullptr;
+
+/**
+ * @brief Construct a new DisplayStub:: DisplayStub object
+ * @param width the width of the frame buffer in pixels
+ * @param height the height of the frame buffer in pixels
+ * @param mirrored whether the display memory lines run right to left, like GRAPH_MIRRORED
+ * @note The last one constructed is the one the stubbed Screen writes into
+*/
+DisplayStub::DisplayStub(unsigned int width, unsigned int height, bool mirrored)
+{
+    this->width = width;
+    this->height = height;
+    this->mirrored = mirrored;
+    this->memory = new unsigned short[width * height]();
+    this->scrollLines = width;
+    DisplayStub::instance = this;
+}
+
+/**
+ * @brief Destroy the DisplayStub:: DisplayStub object
+*/
+DisplayStub::~DisplayStub()
+{
+    if(DisplayStub::instance == this)
+        DisplayStub::instance = nullptr;
+    delete[] this->memory;
+}
+
+/**
+ * @brief Write an area of pixels to the display memory
+ * @param rect the area on the screen
+ * @param pixels the pixel at the top left corner of the area
+ * @param stride the number of pixels from one row to the next
+*/
+void DisplayStub::write(Screen_Rect rect, const unsigned short* pixels, unsigned int stride)
+{
+    unsigned int columns = MIN(rect.width, this->width - MIN(rect.x, this->width));
+    unsigned int rows = MIN(rect.height, this->height - MIN(rect.y, this->height));
+    for(unsigned int row = 0; row < rows; row++)
+        memcpy(&this->memory[(rect.y + row) * this->width + rect.x], &pixels[row * stride], columns * sizeof(unsigned short));
+
+    this->stats.writes++;
+    this->stats.pixels += rect.width * rect.height;
+}
+
+/**
+ * @brief Define the part of the display memory that scrolls, like VSCRDEF
+ * @param top the number of fixed lines above the scrolling area
+ * @param lines the number of lines that scroll
+ * @param bottom the number of fixed lines below the scrolling area
+*/
+void DisplayStub::setScrollArea(unsigned int top, unsigned int lines, unsigned int bottom)
+{
+    this->scrollTop = top;
+    this->scrollLines = lines;
+}
+
+/**
+ * @brief Set the line of the display memory that is shown first in the scrolling area, like VSCRSADD
+ * @param line the line in the display memory
+*/
+void DisplayStub::scroll(unsigned int line)
+{
+    this->scrollLine = line;
+}
+
+/**
+ * @brief Count a frame that went out
+*/
+void DisplayStub::endFrame()
+{
+    this->stats.frames++;
+}
+
+/**
+ * @brief Get what the panel shows, with the scrolling applied
+ * @param pixels where the picture goes, as big as the frame buffer
+*/
+void DisplayStub::snapshot(unsigned short* pixels)
+{
+    for(unsigned int x = 0; x < this->width; x++)
+    {
+        // the panel lines run along the columns, right to left if mirrored
+        unsigned int line = this->mirrored ? this->width - 1 - x : x;
+        if(this->scrollLines > 0 && line >= this->scrollTop && line < this->scrollTop + this->scrollLines)
+            line = this->scrollTop + (line - this->scrollTop + this->scrollLine + this->scrollLines - this->scrollTop % this->scrollLines) % this->scrollLines;
+        unsigned int column = this->mirrored ? this->width - 1 - line : line;
+
+        for(unsigned int y = 0; y < this->height; y++)
+            pixels[y * this->width + x] = this->memory[y * this->width + column];
+    }
+}
+
+/**
+ * @brief Get the width of the display
+ * @return the width in pixels
+*/
+unsigned int DisplayStub::getWidth()
+{
+    return this->width;
+}
+
+/**
+ * @brief Get the height of the display
+ * @return the height in pixels
+*/
+unsigned int DisplayStub::getHeight()
+{
+    return this->height;
+}
+
+/**
+ * @brief Get what went out to the display so far
+ * @return the counters
+*/
+DisplayStub_Stats DisplayStub::getStats()
+{
+    return this->stats;
+}
+
+/**
+ * @brief Start the counters over
+*/
+void DisplayStub::resetStats()
+{
+    this->stats = {0};
+}
+
+/**
+ * @brief Get the display the stubbed Screen writes into
+ * @return the display, or nullptr if there is none
+*/
+DisplayStub* DisplayStub::getInstance()
+{
+    return DisplayStub::instance;
+}
@@ -0,0 +1,51 @@
+#include "FakeINA219.hpp"
+#include "HostClock.hpp"
+
+/**
+ * @brief Take a new sample from the profile, at the current time
+*/
+void FakeINA219::getData()
+{
+    static const int voltages[FAKE_INA219_STEPS] = { 5000000, 9000000, 15000000, 20000000 };
+
+    uint64_t now = HostClock::now();
+    unsigned int phase = now % FAKE_INA219_PERIOD;
+    unsigned int round = (now / FAKE_INA219_PERIOD) % FAKE_INA219_STEPS;
+
+    // a triangle from 0 to 2A and back, with a 1A spike for the first tenth of the second half
+    int ramp = phase < FAKE_INA219_PERIOD / 2 ? phase : FAKE_INA219_PERIOD - phase;
+    this->current = (long long)ramp * 2000000 / (FAKE_INA219_PERIOD / 2);
+    if(phase >= FAKE_INA219_PERIOD / 2 && phase < FAKE_INA219_PERIOD / 2 + FAKE_INA219_PERIOD / 20)
+        this->current += 1000000;
+
+    // a bit of droop under load, 50mV per amp
+    this->voltage = voltages[round] - (long long)this->current * 50000 / 1000000;
+    this->power = (long long)this->voltage * this->current / 1000000;
+}
+
+/**
+ * @brief Get the bus voltage
+ * @return the voltage in microvolts
+*/
+int FakeINA219::getVoltageMicro()
+{
+    return this->voltage;
+}
+
+/**
+ * @brief Get the current
+ * @return the current in microamps
+*/
+int FakeINA219::getCurrentMicro()
+{
+    return this->current;
+}
+
+/**
+ * @brief Get the power
+ * @return the power in microwatts
+*/
+int FakeINA219::getPowerMicro()
+{
+    return this->power;
+}
@@ -0,0 +1,32 @@
+#include "HostClock.hpp"
+#include "pico/stdlib.h"
+
+uint64_t HostClock::time = 0;
+
+/**
+ * @brief Move the clock forward
+ * @param microseconds the time to move it by
+*/
+void HostClock::advance(uint64_t microseconds)
+{
+    HostClock::time += microseconds;
+}
+
+/**
+ * @brief Get the time
+ * @return the time since the start, in microseconds
+*/
+uint64_t HostClock::now()
+{
+    return HostClock::time;
+}
+
+uint32_t time_us_32()
+{
+    return (uint32_t)HostClock::now();
+}
+
+uint64_t time_us_64()
+{
+    return HostClock::now();
+}
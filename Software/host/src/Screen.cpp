@@ -0,0 +1,284 @@
+#include "Screen.hpp"
+#include "DisplayStub.hpp"
+
+// Host version of the screen, the changed areas go straight into the display stub instead of
+// out over SPI. Everything is synchronous, so nothing is ever busy.
+
+Screen* Screen::instance = nullptr;
+
+/**
+ * @brief Construct a new Screen:: Screen object
+ * @param config the screen configuration
+ * @param frameBuffer the frame buffer that is pushed to the display
+*/
+Screen::Screen(screen_config_t* config, unsigned short* frameBuffer)
+{
+    this->config = config;
+    this->frameBuffer = frameBuffer;
+}
+
+/**
+ * @brief Initialize the screen
+*/
+void Screen::init()
+{
+    Screen::instance = this;
+    this->frameTimer = time_us_32();
+}
+
+/**
+ * @brief Mark an area of the frame buffer as changed
+ * @param x the left edge in pixels
+ * @param y the top edge in pixels
+ * @param width the width in pixels
+ * @param height the height in pixels
+*/
+void Screen::invalidate(unsigned int x, unsigned int y, unsigned int width, unsigned int height)
+{
+    this->invalidate({x, y, width, height});
+}
+
+/**
+ * @brief Mark an area of the frame buffer as changed
+ * @param rect the area that changed
+ * @note Merged exactly like on the device, so the pixel counts match
+*/
+void Screen::invalidate(Screen_Rect rect)
+{
+    if(rect.x >= this->config->width || rect.y >= this->config->height)
+        return;
+    if(rect.width > this->config->width - rect.x)
+        rect.width = this->config->width - rect.x;
+    if(rect.height > this->config->height - rect.y)
+        rect.height = this->config->height - rect.y;
+    if(rect.width == 0 || rect.height == 0)
+        return;
+
+    unsigned int i = 0;
+    while(i < this->dirtyCount)
+    {
+        if(!this->touches(this->dirtyRects[i], rect))
+        {
+            i++;
+            continue;
+        }
+
+        rect = this->merge(this->dirtyRects[i], rect);
+        this->dirtyRects[i] = this->dirtyRects[--this->dirtyCount];
+        i = 0;
+    }
+
+    if(this->dirtyCount < SCREEN_MAX_DIRTY_RECTS)
+        this->dirtyRects[this->dirtyCount++] = rect;
+    else
+        this->dirtyRects[this->dirtyCount - 1] = this->merge(this->dirtyRects[this->dirtyCount - 1], rect);
+}
+
+/**
+ * @brief Mark the entire frame buffer as changed
+*/
+void Screen::invalidateAll()
+{
+    this->dirtyRects[0] = {0, 0, this->config->width, this->config->height};
+    this->dirtyCount = 1;
+}
+
+/**
+ * @brief Check if anything has changed since the last update
+ * @return true if there is something to push to the display
+*/
+bool Screen::isDirty()
+{
+    return this->dirtyCount > 0;
+}
+
+/**
+ * @brief Write the changed areas of the frame buffer to the display stub
+*/
+void Screen::update()
+{
+    DisplayStub* display = DisplayStub::getInstance();
+    this->timing.pixels = 0;
+    for(unsigned int i = 0; i < this->dirtyCount; i++)
+    {
+        Screen_Rect rect = this->dirtyRects[i];
+        if(display != nullptr)
+            display->write(rect, &this->frameBuffer[rect.y * this->config->width + rect.x], this->config->width);
+        this->timing.pixels += rect.width * rect.height;
+    }
+
+    this->writeScroll();
+    this->dirtyCount = 0;
+    this->countFrame();
+}
+
+/**
+ * @brief Set the buffer the changed areas are copied into
+ * @param buffer the transfer buffer
+ * @param size the size of the buffer in pixels
+ * @note Not needed on the host, the areas are written right away
+*/
+void Screen::setTransferBuffer(unsigned short* buffer, unsigned int size)
+{
+    this->transferBuffer = buffer;
+    this->transferSize = size;
+}
+
+/**
+ * @brief Mark the start of rendering a new frame
+*/
+void Screen::beginFrame()
+{
+    this->renderStart = time_us_32();
+}
+
+/**
+ * @brief Write the changed areas to the display stub
+*/
+void Screen::submit()
+{
+    this->timing.render = time_us_32() - this->renderStart;
+    this->update();
+}
+
+/**
+ * @brief Write a block of pixels to an area of the display stub
+ * @param rect the area on the screen
+ * @param pixels the pixels of the area, packed
+*/
+void Screen::write(Screen_Rect rect, const unsigned short* pixels)
+{
+    DisplayStub* display = DisplayStub::getInstance();
+    if(display != nullptr)
+        display->write(rect, pixels, rect.width);
+}
+
+/**
+ * @brief Check if a transfer is still running
+ * @return false, the host writes everything right away
+*/
+bool Screen::isBusy()
+{
+    return false;
+}
+
+/**
+ * @brief Wait for the running transfer to finish
+*/
+void Screen::wait()
+{
+}
+
+/**
+ * @brief Define the part of the display memory that scrolls
+ * @param top the number of fixed lines above the scrolling area
+ * @param lines the number of lines that scroll
+ * @param bottom the number of fixed lines below the scrolling area
+*/
+void Screen::setScrollArea(unsigned int top, unsigned int lines, unsigned int bottom)
+{
+    DisplayStub* display = DisplayStub::getInstance();
+    if(display != nullptr)
+        display->setScrollArea(top, lines, bottom);
+}
+
+/**
+ * @brief Set the line of the display memory that is shown first in the scrolling area
+ * @param line the line in the display memory
+ * @note Applied with the next update() or submit(), like on the device
+*/
+void Screen::scroll(unsigned int line)
+{
+    this->scrollLine = line;
+    this->scrollPending = true;
+}
+
+/**
+ * @brief Get the number of frames pushed over the last second of the clock
+ * @return the frame rate
+*/
+unsigned int Screen::getFrameCounter()
+{
+    return this->frameCounter;
+}
+
+/**
+ * @brief Get the timing of the last frame
+ * @return the timing, on the clock of the host
+*/
+Screen_Timing Screen::getTiming()
+{
+    return this->timing;
+}
+
+/**
+ * @brief Get the clock the display is driven with
+ * @return 0, there is no display clock on the host
+*/
+unsigned int Screen::getClock()
+{
+    return 0;
+}
+
+/**
+ * @private
+ * @brief Check if two areas overlap or share an edge
+ * @param a the first area
+ * @param b the second area
+ * @return true if the areas can be merged without covering much extra
+*/
+bool Screen::touches(Screen_Rect a, Screen_Rect b)
+{
+    return a.x <= b.x + b.width && b.x <= a.x + a.width &&
+        a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+
+/**
+ * @private
+ * @brief Get the smallest area covering two areas
+ * @param a the first area
+ * @param b the second area
+ * @return the bounding area
+*/
+Screen_Rect Screen::merge(Screen_Rect a, Screen_Rect b)
+{
+    unsigned int x0 = MIN(a.x, b.x);
+    unsigned int y0 = MIN(a.y, b.y);
+    unsigned int x1 = MAX(a.x + a.width, b.x + b.width);
+    unsigned int y1 = MAX(a.y + a.height, b.y + b.height);
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+/**
+ * @private
+ * @brief Hand the pending scroll position to the display stub
+*/
+void Screen::writeScroll()
+{
+    if(!this->scrollPending)
+        return;
+
+    DisplayStub* display = DisplayStub::getInstance();
+    if(display != nullptr)
+        display->scroll(this->scrollLine);
+    this->scrollPending = false;
+}
+
+/**
+ * @private
+ * @brief Count the frames pushed over the last second
+*/
+void Screen::countFrame()
+{
+    DisplayStub* display = DisplayStub::getInstance();
+    if(display != nullptr)
+        display->endFrame();
+
+    this->frames++;
+    if((time_us_32() - this->frameTimer) > SCREEN_FRAME_COUNTER_PERIOD)
+    {
+        this->frameCounter = this->frames;
+        this->frames = 0;
+        this->frameTimer = time_us_32();
+    }
+}
@@ -0,0 +1,131 @@
+#include "SegmentFont.hpp"
+
+#include <math.h>
+
+/**
+ * @brief Draw the glyphs and pack them into a font asset
+ * @param characters the characters to draw
+ * @return the font asset, it stays around until the next call
+*/
+const unsigned char* SegmentFont::build(const char* characters)
+{
+    alignas(4) static unsigned char font[SEGMENT_FONT_SIZE];
+
+    unsigned int count = MIN(strlen(characters), GLYPH_CACHE_MAX_GLYPHS);
+    GlyphCache_FontHeader* header = (GlyphCache_FontHeader*)font;
+    GlyphCache_FontGlyph* glyphs = (GlyphCache_FontGlyph*)(header + 1);
+    unsigned char* coverage = (unsigned char*)(glyphs + count);
+    *header = { GLYPH_CACHE_FONT_MAGIC, SEGMENT_FONT_HEIGHT, (unsigned short)count };
+
+    unsigned int offset = 0;
+    for(unsigned int i = 0; i < count; i++)
+    {
+        SegmentFont_Line lines[SEGMENT_FONT_MAX_LINES];
+        unsigned int lineCount = SegmentFont::glyph(characters[i], lines);
+        unsigned int width = characters[i] == '.' ? SEGMENT_FONT_DOT_WIDTH : SEGMENT_FONT_WIDTH;
+        if(offset + width * SEGMENT_FONT_HEIGHT > (unsigned int)(font + SEGMENT_FONT_SIZE - coverage))
+        {
+            header->glyphCount = i;
+            break;
+        }
+
+        glyphs[i] = { (unsigned char)characters[i], (unsigned char)width, 0, SEGMENT_FONT_HEIGHT, offset };
+        for(unsigned int y = 0; y < SEGMENT_FONT_HEIGHT; y++)
+            for(unsigned int x = 0; x < width; x++)
+                coverage[offset++] = SegmentFont::coverage(lines, lineCount, x + 0.5f, y + 0.5f, width);
+    }
+    return font;
+}
+
+/**
+ * @private
+ * @brief Get the strokes of a character
+ * @param character the character
+ * @param lines where the strokes go, room for SEGMENT_FONT_MAX_LINES
+ * @return the number of strokes, 0 for characters it does not know
+*/
+unsigned int SegmentFont::glyph(char character, SegmentFont_Line* lines)
+{
+    // the seven segments, top, top right, bottom right, bottom, bottom left, top left and middle
+    static const SegmentFont_Line segments[7] = {
+        {0, 0, 1, 0}, {1, 0, 1, 0.5f}, {1, 0.5f, 1, 1}, {0, 1, 1, 1}, {0, 0.5f, 0, 1}, {0, 0, 0, 0.5f}, {0, 0.5f, 1, 0.5f}
+    };
+    static const unsigned char digits[10] = { 0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07, 0x7f, 0x6f };
+
+    unsigned int count = 0;
+    if(character >= '0' && character <= '9')
+    {
+        for(unsigned int i = 0; i < 7; i++)
+            if(digits[character - '0'] & (1 << i))
+                lines[count++] = segments[i];
+        return count;
+    }
+
+    switch(character)
+    {
+        case '-':
+            lines[count++] = segments[6];
+            break;
+        case '.':
+            lines[count++] = {0.5f, 1, 0.5f, 1};
+            break;
+        case 'V':
+            lines[count++] = {0, 0, 0.5f, 1};
+            lines[count++] = {0.5f, 1, 1, 0};
+            break;
+        case 'A':
+            lines[count++] = {0, 1, 0.5f, 0};
+            lines[count++] = {0.5f, 0, 1, 1};
+            lines[count++] = {0.25f, 0.6f, 0.75f, 0.6f};
+            break;
+        case 'W':
+            lines[count++] = {0, 0, 0.2f, 1};
+            lines[count++] = {0.2f, 1, 0.5f, 0.4f};
+            lines[count++] = {0.5f, 0.4f, 0.8f, 1};
+            lines[count++] = {0.8f, 1, 1, 0};
+            break;
+        case 'm':
+            lines[count++] = {0, 0.45f, 1, 0.45f};
+            lines[count++] = {0, 0.45f, 0, 1};
+            lines[count++] = {0.5f, 0.45f, 0.5f, 1};
+            lines[count++] = {1, 0.45f, 1, 1};
+            break;
+        default:
+            break;
+    }
+    return count;
+}
+
+/**
+ * @private
+ * @brief Get the coverage of a pixel by the strokes
+ * @param lines the strokes
+ * @param count the number of strokes
+ * @param x the center of the pixel
+ * @param y the center of the pixel
+ * @param width the width of the glyph
+ * @return the coverage, 0 to 255
+*/
+unsigned char SegmentFont::coverage(const SegmentFont_Line* lines, unsigned int count, float x, float y, float width)
+{
+    float left = SEGMENT_FONT_MARGIN + SEGMENT_FONT_STROKE / 2;
+    float spanX = width - 2 * left;
+    float top = SEGMENT_FONT_TOP + SEGMENT_FONT_STROKE / 2;
+    float spanY = SEGMENT_FONT_BOTTOM - SEGMENT_FONT_STROKE / 2 - top;
+
+    // the distance to the closest stroke, blended over a pixel at the edge
+    float distance = INFINITY;
+    for(unsigned int i = 0; i < count; i++)
+    {
+        float x0 = left + lines[i].x0 * spanX, y0 = top + lines[i].y0 * spanY;
+        float dx = left + lines[i].x1 * spanX - x0, dy = top + lines[i].y1 * spanY - y0;
+        float length = dx * dx + dy * dy;
+        float t = length > 0 ? ((x - x0) * dx + (y - y0) * dy) / length : 0;
+        t = MIN(MAX(t, 0.0f), 1.0f);
+        float ex = x - (x0 + t * dx), ey = y - (y0 + t * dy);
+        distance = MIN(distance, sqrtf(ex * ex + ey * ey));
+    }
+
+    float alpha = SEGMENT_FONT_STROKE / 2 + 0.5f - distance;
+    return (unsigned char)(MIN(MAX(alpha, 0.0f), 1.0f) * 255);
+}
@@ -0,0 +1,192 @@
+#include "Snapshot.hpp"
+
+#include <string.h>
+
+/**
+ * @brief Write a frame as a binary PPM
+ * @param path the file
+ * @param pixels the frame in RGB565
+ * @param width the width in pixels
+ * @param height the height in pixels
+ * @return true if the file was written
+*/
+bool Snapshot::writePPM(const char* path, const unsigned short* pixels, unsigned int width, unsigned int height)
+{
+    FILE* file = fopen(path, "wb");
+    if(file == nullptr)
+        return false;
+
+    fprintf(file, "P6\n%u %u\n255\n", width, height);
+    for(unsigned int i = 0; i < width * height; i++)
+    {
+        unsigned char rgb[3];
+        Snapshot::toRGB(rgb, pixels[i]);
+        fwrite(rgb, 1, 3, file);
+    }
+    return fclose(file) == 0;
+}
+
+/**
+ * @brief Write a frame as a PNG
+ * @param path the file
+ * @param pixels the frame in RGB565
+ * @param width the width in pixels
+ * @param height the height in pixels
+ * @return true if the file was written
+ * @note The image data goes into stored deflate blocks of one row each, which every decoder takes
+*/
+bool Snapshot::writePNG(const char* path, const unsigned short* pixels, unsigned int width, unsigned int height)
+{
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+    unsigned int row = 1 + width * 3;
+    if(row > 0xffff)
+        return false;
+
+    FILE* file = fopen(path, "wb");
+    if(file == nullptr)
+        return false;
+    fwrite(signature, 1, sizeof(signature), file);
+
+    // 8 bits per channel, truecolor, no interlacing
+    unsigned char header[13] = {
+        (unsigned char)(width >> 24), (unsigned char)(width >> 16), (unsigned char)(width >> 8), (unsigned char)width,
+        (unsigned char)(height >> 24), (unsigned char)(height >> 16), (unsigned char)(height >> 8), (unsigned char)height,
+        8, 2, 0, 0, 0
+    };
+    Snapshot::writeChunk(file, "IHDR", header, sizeof(header));
+
+    // zlib header, then one stored block per row with the filter byte in front, then the adler32
+    unsigned int size = 2 + height * (5 + row) + 4;
+    unsigned char* data = new unsigned char[size];
+    unsigned char* out = data;
+    *out++ = 0x78;
+    *out++ = 0x01;
+
+    uint32_t a = 1, b = 0;
+    for(unsigned int y = 0; y < height; y++)
+    {
+        *out++ = y == height - 1;
+        *out++ = row & 0xff;
+        *out++ = row >> 8;
+        *out++ = ~row & 0xff;
+        *out++ = (~row >> 8) & 0xff;
+
+        unsigned char* line = out;
+        *out++ = 0;
+        for(unsigned int x = 0; x < width; x++, out += 3)
+            Snapshot::toRGB(out, pixels[y * width + x]);
+
+        for(unsigned int i = 0; i < row; i++)
+        {
+            a = (a + line[i]) % 65521;
+            b = (b + a) % 65521;
+        }
+    }
+    uint32_t adler = (b << 16) | a;
+    *out++ = adler >> 24;
+    *out++ = adler >> 16;
+    *out++ = adler >> 8;
+    *out++ = adler;
+
+    Snapshot::writeChunk(file, "IDAT", data, size);
+    Snapshot::writeChunk(file, "IEND", nullptr, 0);
+    delete[] data;
+    return fclose(file) == 0;
+}
+
+/**
+ * @brief Compare a frame with a PPM written earlier
+ * @param path the file
+ * @param pixels the frame in RGB565
+ * @param width the width in pixels
+ * @param height the height in pixels
+ * @return the number of pixels that differ, -1 if the file is missing or has another size
+*/
+int Snapshot::comparePPM(const char* path, const unsigned short* pixels, unsigned int width, unsigned int height)
+{
+    FILE* file = fopen(path, "rb");
+    if(file == nullptr)
+        return -1;
+
+    unsigned int fileWidth = 0, fileHeight = 0, depth = 0;
+    if(fscanf(file, "P6 %u %u %u", &fileWidth, &fileHeight, &depth) != 3 || fgetc(file) == EOF ||
+        fileWidth != width || fileHeight != height || depth != 255)
+    {
+        fclose(file);
+        return -1;
+    }
+
+    int differences = 0;
+    for(unsigned int i = 0; i < width * height; i++)
+    {
+        unsigned char expected[3], actual[3];
+        if(fread(expected, 1, 3, file) != 3)
+        {
+            fclose(file);
+            return -1;
+        }
+        Snapshot::toRGB(actual, pixels[i]);
+        if(memcmp(expected, actual, 3) != 0)
+            differences++;
+    }
+    fclose(file);
+    return differences;
+}
+
+/**
+ * @private
+ * @brief Expand an RGB565 pixel to 8 bits per channel
+ * @param rgb where the three channels go
+ * @param pixel the pixel
+*/
+void Snapshot::toRGB(unsigned char* rgb, unsigned short pixel)
+{
+    unsigned int r = (pixel >> 11) & 0x1f;
+    unsigned int g = (pixel >> 5) & 0x3f;
+    unsigned int b = pixel & 0x1f;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+/**
+ * @private
+ * @brief Run data through the CRC32 of PNG chunks
+ * @param crc the CRC so far, inverted
+ * @param data the data
+ * @param length the number of bytes
+ * @return the new CRC, inverted
+*/
+uint32_t Snapshot::crc(uint32_t crc, const unsigned char* data, unsigned int length)
+{
+    for(unsigned int i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for(unsigned int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+    }
+    return crc;
+}
+
+/**
+ * @private
+ * @brief Write a PNG chunk
+ * @param file the file
+ * @param type the four character type
+ * @param data the data, can be nullptr if the length is 0
+ * @param length the number of bytes
+*/
+void Snapshot::writeChunk(FILE* file, const char* type, const unsigned char* data, unsigned int length)
+{
+    unsigned char size[4] = { (unsigned char)(length >> 24), (unsigned char)(length >> 16), (unsigned char)(length >> 8), (unsigned char)length };
+    fwrite(size, 1, 4, file);
+    fwrite(type, 1, 4, file);
+    if(length > 0)
+        fwrite(data, 1, length, file);
+
+    uint32_t crc = Snapshot::crc(0xffffffff, (const unsigned char*)type, 4);
+    crc = ~Snapshot::crc(crc, data, length);
+    unsigned char check[4] = { (unsigned char)(crc >> 24), (unsigned char)(crc >> 16), (unsigned char)(crc >> 8), (unsigned char)crc };
+    fwrite(check, 1, 4, file);
+}
@@ -0,0 +1,440 @@
+#include "renderer.h"
+
+// the display memory the stubbed screen writes into, it is what the snapshots are taken of
+DisplayStub display(DISP_HEIGHT, DISP_WIDTH, GRAPH_MIRRORED);
+unsigned short frameBuffer[DISP_WIDTH * DISP_HEIGHT];
+unsigned short picture[DISP_WIDTH * DISP_HEIGHT];
+unsigned short readoutPicture[DISP_WIDTH * DISP_HEIGHT];
+
+screen_config_t screenConfig = {
+	.spi = nullptr,
+	.dc = 0,
+	.cs = 0,
+	.width = DISP_HEIGHT,	// the display is rotated into landscape
+	.height = DISP_WIDTH,
+	.offsetX = 0,
+	.offsetY = 0,
+	.pio = nullptr,
+	.sck = 0,
+	.mosi = 0,
+	.pioDivider = 1.0f,
+};
+Screen screen(&screenConfig, frameBuffer);
+unsigned short stripBuffer[2 * DISP_HEIGHT * DISP_STRIP_HEIGHT];
+Strip strip(&screen, stripBuffer, DISP_HEIGHT, DISP_WIDTH, DISP_STRIP_HEIGHT);
+Background background(frameBuffer, DISP_HEIGHT, DISP_WIDTH, 0);
+GlyphCache glyphCache(frameBuffer, DISP_HEIGHT, DISP_WIDTH);
+Graph graph(&screen, frameBuffer, DISP_HEIGHT, DISP_WIDTH, GRAPH_LABEL_WIDTH, GRAPH_MIRRORED);
+Kernels kernels;
+Formatter formatter;
+FakeINA219 ina219;
+
+// the same widgets as the readout and graph pages of the device
+void printLabel(Label* label, Widget_Canvas canvas, void* context);
+Widget_Canvas frameCanvas = {frameBuffer, DISP_HEIGHT, 0, DISP_WIDTH};
+Widget root({0, 0, DISP_HEIGHT, DISP_WIDTH});
+Widget readoutView({0, 0, DISP_HEIGHT, DISP_WIDTH});
+Readout voltageReadout(&glyphCache, &formatter, 'V', READOUT_COLOR);
+Readout currentReadout(&glyphCache, &formatter, 'A', READOUT_COLOR);
+Readout powerReadout(&glyphCache, &formatter, 'W', READOUT_COLOR);
+Label fpsLabel(printLabel, nullptr, {READOUT_FPS_X, READOUT_FPS_Y, DISP_HEIGHT - READOUT_FPS_X, READOUT_FPS_HEIGHT});
+Panel graphView(GRAPH_BACKGROUND, {0, 0, DISP_HEIGHT, DISP_WIDTH});
+Plot plot(&graph, {GRAPH_LABEL_WIDTH, 0, DISP_HEIGHT - GRAPH_LABEL_WIDTH, DISP_WIDTH});
+Label graphLabels[GRAPH_SERIES] = {
+	Label(printLabel, nullptr, {GRAPH_LABEL_X, GRAPH_LABEL_Y, GRAPH_LABEL_WIDTH - GRAPH_LABEL_X, GRAPH_LABEL_SPACING}),
+	Label(printLabel, nullptr, {GRAPH_LABEL_X, GRAPH_LABEL_Y + GRAPH_LABEL_SPACING, GRAPH_LABEL_WIDTH - GRAPH_LABEL_X, GRAPH_LABEL_SPACING}),
+	Label(printLabel, nullptr, {GRAPH_LABEL_X, GRAPH_LABEL_Y + 2 * GRAPH_LABEL_SPACING, GRAPH_LABEL_WIDTH - GRAPH_LABEL_X, GRAPH_LABEL_SPACING}),
+};
+Pager pager(&root);
+
+// command line options
+unsigned int readoutFrames = RENDERER_READOUT_FRAMES;
+unsigned int graphFrames = RENDERER_GRAPH_FRAMES;
+const char* outputDirectory = nullptr;
+const char* compareDirectory = nullptr;
+bool writePNG = false;
+bool runBenchmarks = false;
+
+/**
+ * @brief Time it took to render the frames of a scene, on the clock of the host
+ * @param frames the number of frames rendered
+ * @param minimum the fastest frame in nanoseconds
+ * @param maximum the slowest frame in nanoseconds
+ * @param total all frames together in nanoseconds
+ * @param pixels the number of pixels pushed to the display
+*/
+struct Renderer_Timing
+{
+	unsigned int frames;
+	unsigned long long minimum;
+	unsigned long long maximum;
+	unsigned long long total;
+	unsigned long long pixels;
+};
+
+/**
+ * @brief Label font, draws a block for every character
+ * @param label the label to draw
+ * @param canvas the pixels to draw into
+ * @param context unused
+ * @note Unlike PicoGFX on the device this draws into any canvas, so the labels show up in the strips too
+*/
+void printLabel(Label* label, Widget_Canvas canvas, void* context)
+{
+	Screen_Rect bounds = label->getBounds();
+	const char* text = label->getText();
+	unsigned int length = strlen(text);
+	unsigned int x = bounds.x;
+	if(label->isCentered())
+		x += (bounds.width - MIN(length * RENDERER_LABEL_ADVANCE, bounds.width)) / 2;
+
+	for(unsigned int i = 0; i < length; i++, x += RENDERER_LABEL_ADVANCE)
+	{
+		if(text[i] == ' ')
+			continue;
+		if(x + RENDERER_LABEL_ADVANCE > bounds.x + bounds.width)
+			break;
+		Widget::fill(canvas, {x + 1, bounds.y + RENDERER_LABEL_TOP, RENDERER_LABEL_ADVANCE - 2, RENDERER_LABEL_HEIGHT}, label->getColor());
+	}
+}
+
+/**
+ * @brief Page update, hand the latest sample to the readout
+ * @param context unused
+*/
+void updateReadoutPage(void* context)
+{
+	voltageReadout.setValue(ina219.getVoltageMicro());
+	currentReadout.setValue(ina219.getCurrentMicro());
+	powerReadout.setValue(ina219.getPowerMicro());
+
+	char text[LABEL_MAX_LENGTH];
+	snprintf(text, LABEL_MAX_LENGTH, "%d fps", screen.getFrameCounter());
+	fpsLabel.setText(text);
+}
+
+/**
+ * @brief Page update, show the full scale of each series of the graph
+ * @param context unused
+*/
+void updateGraphPage(void* context)
+{
+	static const char units[GRAPH_SERIES] = { 'V', 'A', 'W' };
+
+	char text[LABEL_MAX_LENGTH];
+	for(unsigned int i = 0; i < GRAPH_SERIES; i++)
+	{
+		formatter.format(text, LABEL_MAX_LENGTH, graph.getScale(i), units[i]);
+		graphLabels[i].setText(text);
+	}
+}
+
+/**
+ * @brief Put the pages together and lay out the readout, like initWidgets() on the device
+*/
+void initWidgets()
+{
+	static const unsigned short colors[GRAPH_SERIES] = { GRAPH_COLOR_VOLTAGE, GRAPH_COLOR_CURRENT, GRAPH_COLOR_POWER };
+
+	pager.add(&readoutView, updateReadoutPage);
+	pager.add(&graphView, updateGraphPage);
+
+	graphView.add(&plot);
+	for(unsigned int i = 0; i < GRAPH_SERIES; i++)
+	{
+		graphLabels[i].setColor(colors[i]);
+		graphView.add(&graphLabels[i]);
+	}
+
+	unsigned int height = glyphCache.getHeight();
+	voltageReadout.setBounds({0, 0, screenConfig.width, height});
+	currentReadout.setBounds({0, height, screenConfig.width, height});
+	powerReadout.setBounds({0, 2 * height + READOUT_POWER_SPACING, screenConfig.width, height});
+	fpsLabel.setColor(GRAPH_COLOR_VOLTAGE);
+	readoutView.add(&voltageReadout);
+	readoutView.add(&currentReadout);
+	readoutView.add(&powerReadout);
+	readoutView.add(&fpsLabel);
+}
+
+/**
+ * @brief Move the clock on by a frame, take a sample and hand it to the page that is shown
+*/
+void sample()
+{
+	HostClock::advance(RENDERER_FRAME_INTERVAL);
+	ina219.getData();
+
+	int samples[GRAPH_SERIES] = { ina219.getVoltageMicro(), ina219.getCurrentMicro(), ina219.getPowerMicro() };
+	graph.push(samples);
+	pager.update();
+}
+
+/**
+ * @brief Render what changed and push it to the display, the way the main loop does
+ * @param strips true to render the readout band by band, like DISP_STRIP_RENDERING
+*/
+void render(bool strips)
+{
+	screen.beginFrame();
+	if(strips && pager.getCurrent() == PAGE_READOUT)
+	{
+		Screen_Rect area = {0, 0, 0, 0};
+		if(root.collect(&area))
+			strip.render(area.y, area.height);
+		return;
+	}
+
+	root.render(frameCanvas, &background, &screen);
+	screen.submit();
+}
+
+/**
+ * @brief Get the time on the clock of the host
+ * @return the time in nanoseconds
+*/
+unsigned long long now()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Sample and render a number of frames
+ * @param frames the number of frames
+ * @param strips true to render the readout band by band
+ * @param fresh false to render the last sample again instead of taking a new one
+ * @return how long the rendering took, the sampling is left out
+*/
+Renderer_Timing run(unsigned int frames, bool strips, bool fresh = true)
+{
+	Renderer_Timing timing = {0, ~0ULL, 0, 0, 0};
+	display.resetStats();
+
+	for(unsigned int i = 0; i < frames; i++)
+	{
+		if(fresh)
+			sample();
+
+		unsigned long long start = now();
+		render(strips);
+		unsigned long long elapsed = now() - start;
+
+		timing.frames++;
+		timing.minimum = MIN(timing.minimum, elapsed);
+		timing.maximum = MAX(timing.maximum, elapsed);
+		timing.total += elapsed;
+	}
+
+	timing.pixels = display.getStats().pixels;
+	return timing;
+}
+
+/**
+ * @brief Take a snapshot of the display, write it out and compare it with the golden image
+ * @param name the name of the scene, which is also the name of the files
+ * @return false if writing failed or the snapshot differs from the golden image
+*/
+bool snapshot(const char* name)
+{
+	display.snapshot(picture);
+	char path[RENDERER_PATH_LENGTH];
+	bool passed = true;
+
+	if(outputDirectory != nullptr)
+	{
+		snprintf(path, sizeof(path), "%s/%s.ppm", outputDirectory, name);
+		passed &= Snapshot::writePPM(path, picture, DISP_HEIGHT, DISP_WIDTH);
+		if(writePNG)
+		{
+			snprintf(path, sizeof(path), "%s/%s.png", outputDirectory, name);
+			passed &= Snapshot::writePNG(path, picture, DISP_HEIGHT, DISP_WIDTH);
+		}
+		if(!passed)
+			printf("%-16s could not be written to %s\n", name, outputDirectory);
+	}
+
+	if(compareDirectory != nullptr)
+	{
+		snprintf(path, sizeof(path), "%s/%s.ppm", compareDirectory, name);
+		int differences = Snapshot::comparePPM(path, picture, DISP_HEIGHT, DISP_WIDTH);
+		if(differences < 0)
+			printf("%-16s no golden image at %s\n", name, path);
+		else if(differences > 0)
+			printf("%-16s %d pixels differ from %s\n", name, differences, path);
+		passed &= differences == 0;
+	}
+	return passed;
+}
+
+/**
+ * @brief Print the timing of a scene
+ * @param name the name of the scene
+ * @param timing the timing
+*/
+void report(const char* name, Renderer_Timing timing)
+{
+	if(timing.frames == 0)
+		return;
+	printf("%-16s %6u frames %10.1f %10.1f %10.1f us %10llu pixels/frame\n", name, timing.frames,
+		timing.minimum / 1000.0, (double)timing.total / timing.frames / 1000.0, timing.maximum / 1000.0,
+		timing.pixels / timing.frames);
+}
+
+/**
+ * @brief Run a function a number of times
+ * @param function the function
+ * @param iterations the number of calls
+ * @return the average time per call in nanoseconds
+*/
+double measure(void (*function)(), unsigned int iterations)
+{
+	unsigned long long start = now();
+	for(unsigned int i = 0; i < iterations; i++)
+		function();
+	return (double)(now() - start) / iterations;
+}
+
+char formatText[READOUT_MAX_LENGTH];
+int formatValue = 0;
+
+/**
+ * @brief Benchmark, draw a full screen linear gradient
+*/
+void benchmarkLinear()
+{
+	kernels.linear(frameBuffer, DISP_HEIGHT, {0, 0, DISP_HEIGHT, DISP_WIDTH});
+}
+
+/**
+ * @brief Benchmark, draw a full screen radial gradient
+*/
+void benchmarkRadial()
+{
+	kernels.radial(frameBuffer, DISP_HEIGHT, {0, 0, DISP_HEIGHT, DISP_WIDTH});
+}
+
+/**
+ * @brief Benchmark, format a value like the readout does
+*/
+void benchmarkFormat()
+{
+	formatter.format(formatText, READOUT_MAX_LENGTH, formatValue, 'V');
+	formatValue += 4000;
+}
+
+/**
+ * @brief Benchmark, restore the entire background
+*/
+void benchmarkBackground()
+{
+	background.restoreAll();
+}
+
+/**
+ * @brief Time the drawing code that runs outside of the frames
+ * @note The frame buffer is drawn over, so the screen has to be drawn again afterwards
+*/
+void benchmarkKernels()
+{
+	const double pixels = DISP_WIDTH * DISP_HEIGHT;
+	kernels.setRadial(DISP_HEIGHT / 2, DISP_WIDTH / 2, DISP_HEIGHT / 2, BACKGROUND_FROM, BACKGROUND_TO);
+
+	double linear = measure(benchmarkLinear, RENDERER_KERNEL_ITERATIONS);
+	double radial = measure(benchmarkRadial, RENDERER_KERNEL_ITERATIONS);
+	double restore = measure(benchmarkBackground, RENDERER_KERNEL_ITERATIONS);
+	double format = measure(benchmarkFormat, RENDERER_FORMAT_ITERATIONS);
+	printf("%-16s %10.1f us/frame %8.2f ns/pixel\n", "linear", linear / 1000.0, linear / pixels);
+	printf("%-16s %10.1f us/frame %8.2f ns/pixel\n", "radial", radial / 1000.0, radial / pixels);
+	printf("%-16s %10.1f us/frame %8.2f ns/pixel\n", "background", restore / 1000.0, restore / pixels);
+	printf("%-16s %10.1f ns/value\n", "format", format);
+}
+
+/**
+ * @brief Read the command line
+ * @param argc the number of arguments
+ * @param argv the arguments
+ * @return false if the arguments make no sense
+*/
+bool parseArguments(int argc, char** argv)
+{
+	for(int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if(strcmp(argv[i], "--out") == 0 && hasValue)
+			outputDirectory = argv[++i];
+		else if(strcmp(argv[i], "--compare") == 0 && hasValue)
+			compareDirectory = argv[++i];
+		else if(strcmp(argv[i], "--frames") == 0 && hasValue)
+			readoutFrames = graphFrames = atoi(argv[++i]);
+		else if(strcmp(argv[i], "--png") == 0)
+			writePNG = true;
+		else if(strcmp(argv[i], "--bench") == 0)
+			runBenchmarks = true;
+		else
+			return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Main function, renders the scenes against the fake INA219
+ * @return 0 if every snapshot was written and matches its golden image
+*/
+int main(int argc, char** argv)
+{
+	if(!parseArguments(argc, argv))
+	{
+		printf("usage: %s [--out <directory>] [--png] [--compare <directory>] [--frames <count>] [--bench]\n", argv[0]);
+		return 2;
+	}
+
+	// the same start as on the device, glyphs, background, then the widgets
+	screen.init();
+	background.init();
+	kernels.setInterpolator(false);
+	glyphCache.load(SegmentFont::build(READOUT_GLYPHS), READOUT_GLYPHS, false);
+
+	kernels.setLinear(DISP_HEIGHT / 2, DISP_WIDTH / 2, DISP_HEIGHT, BACKGROUND_ANGLE, BACKGROUND_FROM, BACKGROUND_TO);
+	kernels.linear(frameBuffer, DISP_HEIGHT, {0, 0, DISP_HEIGHT, DISP_WIDTH});
+	background.save();
+
+	initWidgets();
+	strip.addLayer(Kernels::linearLayer, &kernels);
+	strip.addLayer(Widget::layer, &root);
+	graph.setColor(GRAPH_SERIES_VOLTAGE, GRAPH_COLOR_VOLTAGE);
+	graph.setColor(GRAPH_SERIES_CURRENT, GRAPH_COLOR_CURRENT);
+	graph.setColor(GRAPH_SERIES_POWER, GRAPH_COLOR_POWER);
+	graph.setInterval(GRAPH_INTERVAL);
+
+	bool passed = true;
+	printf("%-16s %13s %10s %10s %10s\n", "scene", "", "min", "avg", "max");
+
+	// the readout through the frame buffer, then the same sample again band by band, which has to come out the same
+	report("readout", run(readoutFrames, false));
+	passed &= snapshot("readout");
+	memcpy(readoutPicture, picture, sizeof(picture));
+	root.invalidate();
+	report("readout strips", run(1, true, false));
+	passed &= snapshot("readout_strips");
+	unsigned int differences = 0;
+	for(unsigned int i = 0; i < DISP_WIDTH * DISP_HEIGHT; i++)
+		differences += picture[i] != readoutPicture[i];
+	if(differences > 0)
+		printf("%-16s %u pixels differ from the readout\n", "readout strips", differences);
+	passed &= differences == 0;
+
+	// the trend graph scrolls through the display memory, the snapshot shows what the panel shows
+	pager.show(PAGE_GRAPH);
+	report("graph", run(graphFrames, false));
+	passed &= snapshot("graph");
+
+	if(runBenchmarks)
+	{
+		pager.show(PAGE_READOUT);
+		report("readout bench", run(readoutFrames, false));
+		report("strips bench", run(readoutFrames, true));
+		benchmarkKernels();
+	}
+
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,88 @@
+#include <limits.h>
+#include <string.h>
+#include "Formatter.hpp"
+
+/*
+ * Checks the formatter against the cases documented in lib/Formatter, exits with 1 if any of them differ.
+ */
+
+static unsigned int failures = 0;
+
+/**
+ * @brief Format a value and compare the result
+ * @param digits the number of significant digits
+ * @param value the value in micro units
+ * @param unit the unit character
+ * @param expected the expected string
+*/
+static void check(unsigned int digits, int value, char unit, const char* expected)
+{
+    Formatter formatter(digits);
+    char text[16];
+    unsigned int length = formatter.format(text, sizeof(text), value, unit);
+    if(length == strlen(expected) && strcmp(text, expected) == 0)
+        return;
+
+    printf("%d with %u digits: expected \"%s\", got \"%s\" (%u)\n", value, digits, expected, length ? text : "", length);
+    failures++;
+}
+
+/**
+ * @brief Format into a buffer of a given size and compare the returned length
+ * @param length the size of the buffer
+ * @param value the value in micro units
+ * @param expected the expected length, 0 if it does not fit
+*/
+static void checkLength(unsigned int length, int value, unsigned int expected)
+{
+    Formatter formatter;
+    char text[16];
+    memset(text, 'x', sizeof(text));
+    unsigned int result = formatter.format(text, length, value, 'V');
+    // nothing may be written past the end of the buffer
+    bool overrun = length < sizeof(text) && text[length] != 'x';
+    if(result == expected && !overrun)
+        return;
+
+    printf("%d into %u bytes: expected %u, got %u%s\n", value, length, expected, result, overrun ? ", wrote past the end" : "");
+    failures++;
+}
+
+int main()
+{
+    // the examples of the readme
+    check(3, 12345678, 'V', "12.3V");
+    check(3, 999600, 'V', "1.00V");
+    check(3, -1500, 'V', "-1.50mV");
+    check(3, -1500, 'A', "-1.50mA");
+    check(3, 0, 'W', "0.00W");
+
+    // rounding carries into the next digit, and into the next prefix
+    check(3, 9996, 'V', "10.0mV");
+    check(3, 999999, 'A', "1.00A");
+    check(3, 999499, 'A', "999mA");
+    check(3, 999999999, 'V', "1.00kV");
+
+    // the sign
+    check(3, -1, 'A', "-1uA");
+    check(3, INT_MIN, 'V', "-2.15kV");
+    check(3, INT_MAX, 'V', "2.15kV");
+
+    // the number of digits, the integer part is never cut short
+    check(1, 95000, 'A', "95mA");
+    check(9, 1234567, 'V', "1.234567V");
+    check(0, 1500000, 'V', "2V");
+
+    // "1.00V" takes 5 characters and the terminator
+    checkLength(6, 1000000, 5);
+    checkLength(5, 1000000, 0);
+    checkLength(0, 1000000, 0);
+
+    if(failures > 0)
+    {
+        printf("%u formatter checks failed\n", failures);
+        return 1;
+    }
+    printf("all formatter checks passed\n");
+    return 0;
+}
@@ -1,5321 +0,0 @@
-/* GIMP RGB C-Source image dump (bg.c) */
-
-static const unsigned char background_image[] =
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\315B\262[\310\061\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030PS\356J\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\012"
-  ":\315Bf)\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\207"
-  ")\262[K:\343\030\343\030\343\030\343\030\343\030\060S\255J\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\311\061\262[K:\343\030\343\030f)qSlB\017S\316J\255BPS\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\315B\262[\310\061\343\030\315B\262[\351\061QS\222[\357J\344\030\012\062"
-  "\262[\262[\262[PS\343\030\344\030K:PS\262[\262[\017S\012\062\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\315"
-  "B\262[\310\061\343\030\315B\262[\017K\207)\214B\262[l:\343\030K:\262[K:\343\030"
-  "\343\030\343\030\343\030*\062\222[\222[\207)\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\315B\262"
-  "[\310\061\343\030\315B\262[K:\343\030f!\262[\356J\343\030K:\262[K:\343\030\343"
-  "\030\343\030E!q[\255B/S\060S\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\315B\262[\310\061\343\030\315"
-  "B\262[\311\061\343\030E!\262[\357J\343\030K:\262[K:\343\030\343\030\343\030\247"
-  ")\060S%!\311\061\060SE!\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\315B\262[\310\061\343\030\315B\262[\310"
-  "\061\343\030E!\262[\357J\343\030K:\262[K:\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\315B\262[\310\061\343\030\315B\262"
-  "[\310\061\343\030E!\262[\357J\343\030*:\262[K:\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\315B\262[\310\061\343\030\315"
-  "B\262[\310\061\343\030E!\262[\357J\343\030\311\061\262[\316J\004\031\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\315B\262[\310"
-  "\061\343\030\315B\262[\310\061\343\030E!\262[\357J\343\030\343\030\316B\222[\222"
-  "[\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\003!\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\004!\004!E)\307\071(BHJ\007B\206\061\004!\004!\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\307\071\256su\255\070\306\373\336]\357\236\367\236\367}\357\034\347y\316"
-  "\266\265\060\204\010B$!\003!\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\003!\007B\024\245]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\236\367\232\326\323\234Mk\347\071"
-  "\004!\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\004!HJ\023\245\034\347\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\337\377]\357\030\306\256sE)\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\003!\347\071\024\245]\357\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\337\377y\316Mk$!\003!\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\003"
-  "!\246\061\262\224\034\347\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\337\377y\316\222\224HJ$!\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\003!e)\222\224\373\336\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377}\357\266\265(B\004!\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\307\071Q\214\373\336\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\373\336,c\003!\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030Mk"
-  "\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\034\347\212R\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004!\060\204}\357\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377y\316\206\061\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004!Q\214\276\367\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377u\255$!\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\003!mk\236\367\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337"
-  "\377\373\336\373\336\337\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\236\367,c\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\347\071\034\347\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\337\377]\357\333\336y\316\226\265q\214"
-  "\327\275\266\265\070\306\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377Y\316$!\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\003!\023\245\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377\236"
-  "\367\373\336\327\275\222\224\266\265Y\316\373\336]\357\337\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377}\357\007B\003!\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\246\061\033\347\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\236\367<\347\272\326\226\265\363\234\323\234U\255\367\275"
-  "\373\336\337\377\377\377\377\377\276\367\276\367\276\367\276\367\276\367"
-  "\236\367\232\326\064\245\064\245\064\245}\357\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\357{\003!\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\020\204\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\276\367\373\336\327\275"
-  "\323\234\262\224\266\265y\316<\347\276\367\377\377\337\377]\357\070\306U\255"
-  "\323\234\323\234\323\234\024\245\363\234\363\234\363\234\024\245\070\306}\357"
-  "\337\377\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\064\245\003!\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030e)y\316\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\337\377\333\336\363\234\363\234\367\275\034\347\276\367\377\377\377\377"
-  "\377\377\236\367y\316U\255\222\224u\255\272\326\236\367\377\377\377\377\377"
-  "\377\377\377\337\377}\357\236\367\276\367\236\367\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\070\306\004"
-  "!\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\003!q\214\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377<\347U\255Q\214\327\275}\357"
-  "\377\377\377\377\377\377\377\377\377\377\337\377\070\306q\214y\316\236\367"
-  "\337\377\377\377\377\377\377\377\377\377\377\377}\357\070\306Q\214u\255\323"
-  "\234\323\234\262\224\323\234\070\306\337\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\034\347e)\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "IJ]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\276\367\333"
-  "\336u\255\363\234\034\347\377\377\337\377\034\347\367\275\226\265\367\275\030"
-  "\306U\255Q\214\030\306\337\377\377\377\377\377\377\377\337\377}\357\333\336"
-  "\367\275\363\234\064\245\232\326\337\377\377\377\377\377\377\377\377\377}"
-  "\357\367\275\232\326\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\235\367HJ\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\003!\262\224\377\377\377\377"
-  "\377\377\377\377\377\377\276\367\232\326\064\245\222\224\070\306<\347\276\367"
-  "\272\326U\255\262\224\327\275\034\347\236\367]\357\034\347\236\367\377\377"
-  "\377\377\377\377\236\367\272\326\226\265\323\234\226\265y\316\034\347\276"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\276\367\312Z\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\004!\327\275\377\377\377\377\377"
-  "\377\333\336\363\234q\214\030\306]\357\337\377\276\367Y\316Q\214\030\306}\357"
-  "\377\377\377\377\377\377\377\377\377\377\276\367\272\326\266\265\024\245Q"
-  "\214\262\224\030\306<\347\337\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377"
-  "\014c\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030$!\232\326\377\377\276\367Q\214\024\245}\357\276"
-  "\367\272\326u\255\024\245\024\245y\316\276\367\377\377\377\377\337\377<\347"
-  "\232\326\030\306\064\245\024\245Y\316<\347\236\367\337\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\256s\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030D)\333\336\377\377\377\377}\357\377\377\272\326q\214\070\306}\357\337"
-  "\377\333\336u\255Q\214\262\224\222\224\262\224\226\265\232\326\373\336\276"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\323\234\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\246\061<\347\377\377\377\377\377\377\377\377\276\367\337\377Y\316\363"
-  "\234\323\234u\255<\347\337\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\337\377\236\367}\357\373\336y\316\327"
-  "\275\266\265\064\245\363\234\226\265\030\306\034\347\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377u\255\003!\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030(B\236"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\064\245\276\367\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\070\306\262\224\024\245\064\245\226\265\070\306\333\336<\347"
-  "}\357\236\367\276\367}\357\034\347\226\265U\255\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\030\306\004!\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030iJ\276\367\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\276\367\367\275\337\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\373\336\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\272\326$!\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030IJ\276"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377<\347\246\061\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\010B\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377]\357\307"
-  "\071\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\262[\017K\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\246\061\034\347\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\276\367(B\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\315BK:\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\357JQS\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030E)\333\336\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\337\377}\357<\347\333\336<\347\276\367\337"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\337\377\236\367\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\276\367\312"
-  "Z\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\017SQS\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030$!\030\306\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "]\357\266\265\323\234\262\224\226\265\327\275Y\316\266\265\064\245\222\224"
-  "Y\316\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\276\367\064\245Y\316\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377mk\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\262[\017K\343\030\343\030\262[\316J\316J\222[qS\012\062\343\030\060S\262[\262"
-  "[\262[*:\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\064\245\377\377\377\377"
-  "\377\377\377\377\377\377]\357\266\265q\214\034\347\276\367\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\337\377\070\306\337\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367Q\214y\316\377"
-  "\377\377\377\377\377\337\377\236\367\034\347\030\306\276\367\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\020\204\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\262[\017K\343\030\343\030\262[q["
-  "l:\206)q[q[\343\030\343\030QSQS\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\020\204\377\377\377\377\377\377\377\377\070\306\323\234\333\336"
-  "\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\323\234\373\336\373\336Y\316\363\234\014cIJ\212R"
-  "\226\265\327\275\266\265\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\221\224\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\262[\017K\343\030\343\030\262[qS\343\030\343\030\356J\262[F!\343\030QS"
-  "QS\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\353Z\337\377"
-  "\377\377\377\377\337\377\222\224\337\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\030\306\034\347\236\367\377\377\377\377\367"
-  "\275\377\377\377\377\377\377\377\377\232\326<\347\377\377]\357\024\245\030"
-  "\306\064\245Y\316\246\061\040\000\000\000\246\061]\357\272\326\030\306\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\064\245\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\262[\017K\343\030\343\030\262[/S"
-  "\343\030\343\030\316J\262[\247)\343\030QSQS\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\307\071]\357\377\377\377\377\377\377\236\367\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\034\347"
-  "u\255\262\224\222\224Y\316\262\224\337\377\377\377\377\377\377\377\232\326"
-  "y\316\377\377\272\326\323\234\363\234\337\377]\357e)\000\000\000\000\040\000\363\234"
-  "q\214}\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377u\255\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\262[\017K"
-  "\343\030\343\030\262[\017K\343\030\343\030\316J\262[\247)\343\030QSQS\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030$!y\316\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377]\357\266\265\222\224\222\224"
-  "\317{\262\224Y\316\276\367\276\367\070\306\212R}\357\377\377\377\377\377\377"
-  "]\357\064\245\377\377\377\377\232\326U\255}\357\333\336\010B\242\020E)Mk\064"
-  "\245}\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\367\275\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\262[\017K\343\030\343\030\262[\017K\343\030\343\030\316J\262[\247)\343\030PSqS"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\003!U\255\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\373\336\020\204\266\265\343"
-  "\030\000\000\000\000E)U\255\060\204U\255\236\367\363\234\034\347\377\377\377\377\377"
-  "\377\236\367\363\234\377\377\377\377\377\377\030\306\363\234\327\275\266\265"
-  "\232\326]\357\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\027\306\003!\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\262[\017K\343\030\343\030\262[\017K\343\030\343\030\316"
-  "J\262[\247)\343\030\017S\222[\207)\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\003!\256s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\222"
-  "\224<\347\272\326\343\030\000\000\000\000\040\000\030\306\377\377y\316q\214\030\306\333"
-  "\336\377\377\377\377\377\377\236\367\363\234\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\272\326\004!\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\262[\017K\343"
-  "\030\343\030\262[\017K\343\030\343\030\316J\262[\247)\343\030\250)qS\262[\214B"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\007B}\357\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\226\265\232\326\030\306\202\020\000\000\000\000\040"
-  "\000\367\275\377\377\232\326\064\245\333\336\030\306\377\377\377\377\377\377"
-  "\236\367\363\234\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377<\347D)\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030$!\272\326\377\377\377\377\377\377"
-  "\377\377\377\377\377\377<\347Q\214\327\275\206\061\000\000\000\000\206\061\327\275"
-  "\024\245\323\234\276\367\236\367u\255\377\377\377\377\377\377\337\377Q\214"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377]\357\206"
-  "\061\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\003!U\255\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\236\367\070\306\226\265\363\234\262\224u\255\030\306}"
-  "\357\377\377\377\377\337\377\323\234\377\377\377\377\377\377\377\377u\255"
-  "\034\347\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\307"
-  "\071\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\020\204\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\337\377\262\224\377\377\377\377\377\377"
-  "\377\377<\347\266\265\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\236\367\347\071\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030IJ\236\367\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\222\224\377\377\377"
-  "\377\377\377\377\377\337\377\323\234\337\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\236\367\347\071\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030D)\272"
-  "\326\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377U\255"
-  "\236\367\377\377\377\377\377\377\377\377\226\265\373\336\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377}\357\246\061\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\003!\266\265\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\266\265}\357\377\377\377\377\377\377\377\377<\347\363\234\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\373\336$!\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030E)MkIJ\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\003!\222\224"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\363\234"
-  "\236\367\377\377\377\377\377\377\377\377\377\377\024\245\030\306\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377y\316$!\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\307\071\034\347\236\367\323\234$!\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030Lk"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377q\214\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\337\377\266\265\226\265\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377u\255\003!\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030Q\214\337\377\337\377y\316\363\234\262\224\246\061"
-  "iJ(B\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\347\071\235"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\367\275\070\306\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\323\234<\347\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\317{\003!\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\017\204]\357\377\377\377\377\377\377\236\367\337"
-  "\377\236\367\327\275\010B\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030$!"
-  "Y\316\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377}\357\222\224\337\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377y\316y\316\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\276\367\252R\003!\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\212RY\316\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\373\336\313Z\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\020"
-  "\204\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377y\316y\316\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\232\326y\316\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\373\336\307\071\003!\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030iJ\337\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\276\367\272\326\226\265\222\224\216s\246\061\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\246\061]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377y\316y\316\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\327\275\333\336"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\373\336\070\306Lk\205\061\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\353Z\337\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377<\347"
-  "u\255Mk$!\003!\003!\003!\343\030\343\030\343\030\343\030\343\030\343\030\004!y\316\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377}\357\222\224\337\377\377\377\377\377\337\377"
-  "<\347\034\347\276\367\337\377\236\367q\214\276\367\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\266\265IJU\255\060"
-  "\204\003!\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\014c\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377<\347\327\275"
-  "\262\224\256s(B$!\004!\003!\343\030\343\030$!\064\245\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\030\306\226\265\337\377\333\336\020\204\226\265\226\265\222\224"
-  "\262\224\222\224\333\336\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\337\377\337\377\030\306$!<\347\030\306\004!\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030iJ\276"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\236\367\373\336y\316\064\245\357{\256s\353Z\262\224\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\367\275\024\245\266\265}\357\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\373\336\232\326\030\306\303\030y\316<\347"
-  "\010B\003!\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004"
-  "!q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377\323"
-  "\234\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\373\336\236\367\327\275<\347"
-  "u\255\020\204\020\204\337\377\363\234\004!\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\256s\235\367\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\327\275\333\336\327\275]\357\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\024\245}\357q\214\373\336\222\224y\316\010B\232\326\236\367\017\204\004!"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\070\306\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\357"
-  "{mk\276\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\333\336\337\377\377\377<\347\333\336\327\275\272"
-  "\326\377\377\377\377\377\377\266\265\337\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\337\377y\316\064\245\377\377\363\234\060\204Q\214\266\265u\255\256s\336"
-  "\377\276\367\225\265HJ$!\004!\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\246\061<\347\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\367\275q\214\226\265\064\245\236\367\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\236\367\222\224\377\377\337\377q\214\222"
-  "\224Y\316\313Z<\347\377\377\377\377\064\245\337\377\377\377u\255\337\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236"
-  "\367U\255IJy\316\236\367\024\245\363\234\212R\367\275\327\275\367\275\276"
-  "\367\377\377\377\377\276\367\272\326\363\234IJ\004!\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004!U\255\377\377"
-  "\377\377\377\377]\357\333\336\337\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\337\377\024\245\064\245mk\337\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\030\306\232\326\377\377<\347\357{\226\265\327"
-  "\275}\357\337\377\377\377\377\377\222\224}\357\377\377\327\275<\347\377\377"
-  "\377\377\377\377\276\367\377\377\377\377\377\377\377\377\337\377u\255\323"
-  "\234mk\226\265<\347}\357\363\234\024\245\064\245\222\224\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377]\357\266\265\353Z$!\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004!\020\204\064\245Q\214\014"
-  "cE)\303\030mkY\316\276\367\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367Mk\222\224"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377]\357\070\306\323"
-  "\234\337\377\377\377\367\275\014cy\316}\357\276\367\337\377}\357]\357\323"
-  "\234<\347\377\377\333\336\030\306\070\306\337\377\377\377u\255}\357\377\377"
-  "\377\377\377\377\377\377\034\347Mk\232\326\323\234}\357\020\204\367\275\272"
-  "\326\367\275\323\234\276\367\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\336\377y\316\020\204\307\071\347\071\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004!\343\030\343\030\003!\343"
-  "\030\004!\014c\030\306\337\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\030\306\262\224\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\064\245\024\245y\316\377\377]"
-  "\357mk\004!\303\030\010B\014cMk\246\061\246\061\222\224\276\367\377\377\236\367"
-  "y\316u\255}\357\377\377\070\306\333\336\377\377\377\377\377\377\337\377\317"
-  "{\363\234\064\245u\255\272\326\363\234\030\306\337\377\262\224u\255<\347\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377<\347T\255\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030Q\214"
-  "}\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\266\265\232\326\337\377\377\377\377\377\377"
-  "\377\377\377\236\367\222\224\367\275\337\377\337\377\317{\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000A\010\020\204\236\367\377\377\377\377Y\316\064\245\377\377\373"
-  "\336y\316\373\336\377\377\377\377u\255y\316\034\347Q\214<\347\262\224\357"
-  "{\262\224\337\377]\357\070\306\272\326\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030(BY\316\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\276\367\020\204\373\336}\357\333\336\377\377\377\377\226\265\373\336\377"
-  "\377\377\377\034\347$!\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\317{<\347"
-  "\377\377\276\367\333\336\377\377\373\336y\316\020\204<\347\377\377\373\336"
-  "\377\377\367\275\373\336\337\377\262\224\060\204\367\275\030\306\337\377\232"
-  "\326y\316\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030e)\266\265\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377}\357\323\234\363"
-  "\234\226\265\377\377<\347\323\234\377\377\377\377\377\377\070\306A\010\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\010B\333\336\377\377\377\377\377"
-  "\377y\316\024\245IJ\373\336<\347\232\326\377\377Y\316\236\367\323\234\014c"
-  "u\255\333\336\064\245Y\316\363\234\034\347\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030E)"
-  "\030\306\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\070\306iJ\226\265\377\377\222\224\232\326\266\265\276"
-  "\367\377\377\030\306\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\060\204\377\377\377\377\377\377\377\377\373\336\353Z\276\367<\347\367\275"
-  "\377\377\377\377\377\377\323\234\353Z]\357U\255\377\377\377\377\030\306\337"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030e)U\255\276\367\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377}\357IJ\226\265\337\377"
-  "\216s<\347\357{\373\336\377\377y\316\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\206\061q\214\377\377\377\377\377\377\377\377\337\377U\255\276"
-  "\367\232\326y\316\272\326\236\367\272\326\014c\216s\034\347]\357\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\020"
-  "\204\034\347\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "y\316\357{U\255\276\367\327\275\363\234IJ\030\306\377\377\276\367iJ\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\343\030u\255\226\265\377\377\377\377\377"
-  "\377\377\377\377\377\363\234\236\367\020\204\276\367Y\316Y\316\323\234\262"
-  "\224\222\224\030\306\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030iJ\232\326\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\232\326}\357\363\234\276\367\030\306"
-  "\307\071\060\204<\347\337\377\377\377u\255\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\242\020U\255Y\316\030\306\377\377\377\377\377\377\377\377\377\377\024\245"
-  "\276\367\373\336\377\377}\357\212Ry\316\024\245\232\326\276\367\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\246\061u\255\276\367\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\034\347\262\224iJMkq\214\226\265]\357\377\377\236\367"
-  "\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\303\030u\255<\347q\214\276\367\377\377\377"
-  "\377\377\377\377\377\377\377\337\377\377\377\377\377}\357\363\234\252R<\347"
-  "\024\245\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004!\020\204\337"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\317{Q\214\030"
-  "\306\323\234\266\265]\357\377\377\377\377\060\204\256s\040\000\000\000A\010\040\000\040"
-  "\000E)\266\265\337\377\363\234\034\347\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\327\275\222\224\030\306\064\245\262\224\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030u\255\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\034\347\020\204\363\234\367\275"
-  "\327\275U\255\276\367\377\377\377\377\266\265y\316\327\275\030\306Y\316Y\316"
-  "y\316\373\336\337\377u\255\367\275\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\236\367\337\377<\347iJ\323\234\232\326\313ZU\255\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\347\071<\347\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\030\306\327\275\236\367\216s\333\336"
-  "\323\234\377\377\377\377\377\377\236\367Q\214\034\347\337\377\377\377\377"
-  "\377\377\377}\357\363\234\030\306\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377y\316y\316Q\214\313Z\226\265\070\306Q\214\276\367"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004"
-  "!\357{]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326"
-  "\064\245\262\224\377\377\377\377\377\377\377\377}\357\363\234Q\214\262\224"
-  "\226\265\222\224\222\224\373\336\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\276\367\317{\347\071\252R\333\336u\255\034"
-  "\347\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\004!\353Z\332\336\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\226\265\252R\236\367\070\306\377\377\377\377\377\377\377\377"
-  "\377\377\236\367]\357\276\367\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\337\377\030\306\020\204iJ\327\275\337"
-  "\377}\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\003!\252R\034\347\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377}\357\010BY\316\323\234\337\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377U\255\347\071,cmk\373\336\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\004!\215s\236\367\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\266\265mk\020\204\337\377\377\377\276"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\236\367,c\222\224\262\224\024"
-  "\245\323\234\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004!Q\214"
-  "\276\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377]\357\222\224\020\204\367"
-  "\275\337\377\363\234\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\226\265\357"
-  "{\276\367\367\275<\347Y\316\276\367\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030D)\064\245\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377Y\316"
-  "\024\245\226\265U\255U\255\272\326\377\377\337\377\377\377\377\377\377\377"
-  "\337\377\236\367<\347\276\367\266\265\377\377\377\377\034\347\246\061Y\316"
-  "\377\377}\357\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272"
-  "\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030$!\367\275\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\070\306\333\336\333\336\262\224\357{\373\336\222\224\373\336\377"
-  "\377\377\377\232\326,cy\316\377\377Q\214y\316Y\316Mk\020\204\323\234\226\265"
-  "\030\306\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\347\071\030\306\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377}\357u\255\377\377\377\377\266\265\020\204(B\357{<\347\226\265u\255\004"
-  "!u\255\272\326\014ciJ\070\306\020\204\034\347\337\377\034\347\337\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\206\061\030\306\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337"
-  "\377\377\377\377\377}\357\272\326\323\234\347\071(Bmkmk\206\061mk\222\224i"
-  "J,c\030\306}\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\246\061\024\245\276\367\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377}\357\256s\357{\272\326]\357\216su\255\377\377\262\224}\357"
-  "\226\265\226\265\030\306\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\060\204\276\367\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\323\234\060\204]\357\377\377\034\347\034\347\377\377"
-  "\272\326\377\377\377\377\034\347\034\347\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030$!\363\234\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\276\367}\357\034\347\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030E)\327\275"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030(B]\357\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\003!\226\265\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\353Z\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030$!Y\316\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\003!\327\275\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030U\255\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272"
-  "\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030iJ\336\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030$!\\\357\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\003!\231\326\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\003!u\255\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\317{\337\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\206\061\333"
-  "\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\256s\337\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030E)\272\326\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\003!\017\204\337"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\306\071\333\336\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\222\224\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030(B}\357\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004"
-  "!\070\306\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\003!\262\224\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\003!mk\337\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\205\061\373\336\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\003!\327"
-  "\275\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\262\224\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030mk\337\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030IJ\276\367\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272"
-  "\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\206\061<\347\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "E)\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\004!\030\306\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\003!U\255\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\003!\357{\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\252R\337\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272"
-  "\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\306\071]\357"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\003"
-  "!E)\332\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\004!\070\306\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\004!U\255\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\222\224\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030Mk\337\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\010B}\357"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\004!\232\326\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\004!\266\265\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030U\255\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\060\204\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\357{\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\216"
-  "s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030iJ\276\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\246\061\235\367\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\206\061}\357\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030e)\034\347\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030e)\332\336\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030e)\272\326\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030e)\272\326"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "e)\332\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030D)\373\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\205\061}\357\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\206\061}\357\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\206\061}\357\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\306\071\235\367\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\211R\276"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272"
-  "\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\353Z\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\216s\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030q\214\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\226\265\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\004!\070\306\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\347\071}\357\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272"
-  "\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\357"
-  "{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\003!\363\234\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\003!\367\275\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\272\326\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343"
-  "\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030\343\030"
-  "\343\030\343\030\343\030\343\030e)X\316\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377y\316";
\ No newline at end of file
@@ -57,6 +57,79 @@
 #define DISP_OFFSET_Y0      34      // cut off on the top of the display
 #define DISP_OFFSET_Y1      34      // ut off on the bottom of the display
 #define DISP_ROTATION       3       // 0, 1, 2, or 3
+#define DISP_SPI_BAUDRATE   62500000    // the SPI runs off clk_peri and can do half of it at most, 62.5 MHz
+#define DISP_PIO            pio0        // PIO instance the frames are sent through, nullptr for the SPI instance
+#define DISP_PIO_DIVIDER    1.0f        // the display clock is half the state machine clock, 62.5 MHz at 125 MHz
+#define DISP_IDLE_MAX_TIMEOUT   1800    // seconds, both timeouts together have to fit in the 32 bit microsecond timer
+
+// Background, a linear gradient across the circle around the center of the screen
+#define BACKGROUND_ANGLE    10          // degrees
+#define BACKGROUND_FROM     0xfa20      // orange red in RGB565
+#define BACKGROUND_TO       0xb5a8      // dark yellow in RGB565
+
+// Readout widgets, each one is only pushed to the display when its text changes
+#define READOUT_LINE_LENGTH     16
+#define READOUT_GLYPHS          "0123456789.-mVAW"      // pre-rasterized for the readout, the INA219 never goes below milli or above kilo
+#define READOUT_COLOR           0xffff                  // white in RGB565
+#define READOUT_POWER_SPACING   10                      // the power line sits a bit further down
+#define READOUT_FPS_X           230                     // the frame counter in the top right corner
+#define READOUT_FPS_Y           10
+#define READOUT_FPS_HEIGHT      30                      // a line of RobotoMono24
+
+// Pages, the up and down buttons go through them and the menu button acts on the one that is shown
+#define PAGE_READOUT            0
+#define PAGE_GRAPH              1
+#define PAGE_STATISTICS         2
+#define PAGE_PD                 3
+#define PAGE_SETTINGS           4
+#define PAGE_LINE_X             10                      // the text pages are lines of RobotoMono24
+#define PAGE_LINE_Y             10
+#define PAGE_LINE_HEIGHT        30
+#define PAGE_LINE_COLOR         0xffff                  // white in RGB565
+#define PAGE_HEADER_COLOR       0xafe5                  // GreenYellow in RGB565
+#define PAGE_SELECTED_COLOR     0xfa20                  // OrangeRed in RGB565, the setting that is being edited
+#define STATISTICS_LINES        5                       // header, voltage, current, power, energy and charge
+#define PD_LINES                5
+#define SETTINGS_LINES          3                       // trip current, max FPS and a hint
+#define SETTING_TRIP_CURRENT    0                       // the settings in the order the menu button goes through them
+#define SETTING_MAX_FPS         1
+#define SETTINGS                2
+#define SETTINGS_TRIP_STEP      100                     // mA per press
+#define SETTINGS_TRIP_MIN       100                     // mA
+#define SETTINGS_TRIP_MAX       5000                    // mA
+#define SETTINGS_FPS_STEP       5                       // frames per second per press
+#define SETTINGS_FPS_MAX        60                      // 0 turns the pacing off
+
+// Strip rendering of the readout page, the bands are rendered in the transfer buffer, one while the other is going out.
+// The other pages still go through the frame buffer, so it stays allocated
+#define DISP_STRIP_HEIGHT           16      // rows per band
+
+// Transfer buffer the changed areas are copied into while the DMA streams them to the display. A readout
+// update is about 34K pixels, bigger than half a frame, so it goes through in chunks of a quarter frame and
+// the last two of them are still going out while the next frame renders. The strip renderer only needs room for two bands
+#ifdef DISP_STRIP_RENDERING
+#define DISP_TRANSFER_BUFFER_SIZE   (2 * DISP_HEIGHT * DISP_STRIP_HEIGHT)
+#else
+#define DISP_TRANSFER_BUFFER_SIZE   (DISP_WIDTH * DISP_HEIGHT / 2)
+#endif
+
+// Frame pacing, a frame is only rendered when the readout changed, but at least once per interval
+#define DISP_MAX_FRAME_INTERVAL     1000000 // 1s
+
+// Trend graph, one of the pages. The plot scrolls through the display memory,
+// everything left of it stays put and holds the full scale of each series
+#define GRAPH_LABEL_WIDTH           88      // fixed area on the left, fits 6 characters
+#define GRAPH_LABEL_SPACING         30      // distance between the labels, in pixels
+#define GRAPH_LABEL_X               4       // where the first label starts
+#define GRAPH_LABEL_Y               10
+#define GRAPH_SERIES_VOLTAGE        0
+#define GRAPH_SERIES_CURRENT        1
+#define GRAPH_SERIES_POWER          2
+#define GRAPH_MIRRORED              true    // rotation 3 runs the display memory lines right to left
+#define GRAPH_INTERVAL              100000  // 100ms per column, 23s across the screen
+#define GRAPH_COLOR_VOLTAGE         0xafe5  // GreenYellow in RGB565
+#define GRAPH_COLOR_CURRENT         0xfa20  // OrangeRed in RGB565
+#define GRAPH_COLOR_POWER           0xffff  // White in RGB565
 
 // I2C constants
 #define I2C0_SPEED          1000000  // 1 MHz
@@ -64,6 +137,104 @@
 
 // System constants
 #define MULTICORE_FLAG_VALUE        0x69
+#define CORE1_STACK_SIZE            8192    // bytes, the UI core formats text and runs the benchmarks on its own stack
+
+// State of the output that goes along with every sample in the measurement snapshot
+#define SAMPLE_OUTPUT_ENABLED       0x01    // the output is on
+#define SAMPLE_OVERCURRENT          0x02    // the fuse tripped, the output stays off until it is turned on again
+
+// Commands from the control core to the UI core, through the inter-core FIFO
+#define COMMAND_PAGE                1       // argument 1 for the next page, 0 for the previous one
+#define COMMAND_WAKE                3       // a button was pressed or the fuse tripped
+#define COMMAND_REGISTERS           4       // the display registers might have changed
+#define COMMAND_BENCHMARK           5       // argument is the identifier of the benchmark
+#define COMMAND_LOAD                6       // argument 1 draws the whole screen again on every pass, 0 goes back to normal
+
+// Flight recorder constants
+#define FLASH_RECORDER_OFFSET       (PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE)     // last sector of the flash
+#define RECORD_SAMPLES_PER_PAGE     32      // samples per read of PFuse_Record_Data
+
+// Background cache constants, a header page followed by the pixels rounded up to full sectors
+#define FLASH_BACKGROUND_SIZE       ((FLASH_PAGE_SIZE + DISP_WIDTH * DISP_HEIGHT * 2 + FLASH_SECTOR_SIZE - 1) & ~(FLASH_SECTOR_SIZE - 1))
+#define FLASH_BACKGROUND_OFFSET     (FLASH_RECORDER_OFFSET - FLASH_BACKGROUND_SIZE)     // right below the flight recorder
+
+// Benchmarks, write the identifier to Device_Benchmark and read the results from Device_Benchmark_Result
+#define BENCHMARK_FORMAT            1       // [0] printf, [1] fixed point formatter, in cycles per value
+#define BENCHMARK_IMAGE             2       // [0] raw copy through XIP, [1] compressed decode, in cycles per half frame,
+                                            // [2] compressed size, [3] raw size, in bytes
+#define BENCHMARK_IMAGE_ITERATIONS  10
+#define BENCHMARK_STRIP             3       // [0] full frame, [1] strips, in cycles per redraw of the readout including the transfer,
+                                            // [2] bytes of RAM the pixels take in this build, the frame buffer and the transfer buffer,
+                                            // [3] of those the band buffers, the frame buffer stays allocated in both builds
+#define BENCHMARK_STRIP_ITERATIONS  10
+#define BENCHMARK_DISPLAY           5       // [0] cycles per full frame transfer, [1] bytes per second,
+                                            // [2] display clock in Hz, [3] 1 if sent through PIO
+#define BENCHMARK_DISPLAY_ITERATIONS 10
+#define BENCHMARK_KERNELS           6       // in pixels per second, [0] PicoGFX rotated circle gradient,
+                                            // [1] linear gradient, [2] radial gradient, [3] rotated texture, [4] color ramp,
+                                            // [5] to [8] the same through the interpolators
+#define BENCHMARK_KERNELS_ITERATIONS 10
+#define BENCHMARK_TEXTURE_BITS      6       // the rotated texture is 64 by 64 pixels
+#define BENCHMARK_LATENCY           7       // of the sampling task in microseconds, [0] max lateness, [1] max runtime,
+                                            // [2] frames per second, with the UI idle, [3] to [5] the same with the UI redrawing
+                                            // the whole screen on every pass
+#define BENCHMARK_LATENCY_PHASE     4000000 // 4s per phase
+#define BENCHMARK_LATENCY_SETTLE    2100000 // the task statistics cover the last second, skip the ones that started before the phase
+
+// Supervised tasks, the identifier is reported in Device_Stalled_Task after a stall.
+// The render task runs on the UI core, the others on the control core
+#define TASK_SAMPLING               0
+#define TASK_USB                    1
+#define TASK_REGISTERS              2
+#define TASK_BUTTONS                3
+#define TASK_RENDER                 4
+#define TASKS                       5
+#define TASK_STATS                  4       // Device_Task_Timing holds runs per second, overruns, max lateness and max runtime of each task
+
+// Maximum time between two heartbeats of each task
+#define TASK_SAMPLING_TIMEOUT       250000  // 250ms
+#define TASK_USB_TIMEOUT            250000  // 250ms
+#define TASK_REGISTERS_TIMEOUT      250000  // 250ms
+#define TASK_BUTTONS_TIMEOUT        250000  // 250ms
+#define TASK_RENDER_TIMEOUT         500000  // 500ms
+
+// Period of each task, and its priority. The lower the priority the more urgent the task.
+#define TASK_SAMPLING_PERIOD        2000    // 2ms, the INA219 averages over 34ms so this is mostly the fuse latency
+#define TASK_SAMPLING_PRIORITY      0
+#define TASK_BUTTONS_PERIOD         5000    // 5ms, well within the 20ms debounce time
+#define TASK_BUTTONS_PRIORITY       1
+#define TASK_USB_PERIOD             5000    // 5ms
+#define TASK_USB_PRIORITY           2
+#define TASK_REGISTERS_PERIOD       10000   // 10ms
+#define TASK_REGISTERS_PRIORITY     3
+#define TASK_RENDER_PERIOD          5000    // 5ms, the pacer decides whether a frame is actually rendered
+#define TASK_RENDER_PRIORITY        4
+
+// Profiled stages of the main loops, Device_Loop_Timing holds the min, avg and max cycles of each stage in a row of 3.
+// Each core profiles its own stages, SysTick is per core
+#define STAGE_SAMPLING              0       // ina219.getData, the fuse and its LEDs
+#define STAGE_USB                   1
+#define STAGE_REGISTERS             2
+#define STAGE_BUTTONS               3
+#define STAGE_BACKGROUND            4       // UI core, restoring what is behind the widgets, nested in STAGE_TEXT
+#define STAGE_TEXT                  5       // UI core, drawing the widgets
+#define STAGE_DISPLAY               6       // UI core, handing the frame to the display
+#define STAGE_OTHER                 7       // everything else on the control core, the sleep until the next deadline included
+#define STAGES                      8
+#define STAGES_UI                   ((1 << STAGE_BACKGROUND) | (1 << STAGE_TEXT) | (1 << STAGE_DISPLAY))
+#define STAGE_NAMES                 "SURBGTDO"  // a letter per stage on the overlay
+#define STAGE_LOOPS                 24      // index of the passes of the control scheduler per second in Device_Loop_Timing
+#define STAGE_OVERHEAD              25      // index of the cycles per probe in Device_Loop_Timing
+#define STAGE_PLACEMENT             26      // index of the placement in Device_Loop_Timing, 1 when built with HOT_RAM
+#define STAGE_UI_LOOPS              27      // index of the passes of the UI scheduler per second in Device_Loop_Timing
+
+// Debug overlay with the average and maximum microseconds of each stage, enabled through Display_Debug_Overlay
+#define OVERLAY_LINES               4       // two stages per line
+#define OVERLAY_X                   4
+#define OVERLAY_Y                   (DISP_WIDTH - OVERLAY_LINES * PAGE_LINE_HEIGHT - 4)
+#define OVERLAY_COLOR               0x0000  // black in RGB565
+#define OVERLAY_TEXT_COLOR          0xffff  // white in RGB565
+#define OVERLAY_MAX_VALUE           9999    // microseconds, larger values are clamped to fit the line
 
 
 
@@ -92,10 +263,12 @@
  */
 
 #include <stdio.h>
+#include <limits.h>
 #include "pico/stdlib.h"
 #include "pico/bootrom.h"
 #include "pico/binary_info.h"
 #include "pico/time.h"
+#include "pico/multicore.h"
 #include "tusb.h"
 
 #include "hardware/uart.h"
@@ -107,11 +280,42 @@
 #include "Memory.hpp"
 #include "version.h"
 #include "Registers.hpp"
+#include "Supervisor.hpp"
+#include "Scheduler.hpp"
+#include "Measurement.hpp"
+#include "Mailbox.hpp"
+#include "Lockout.hpp"
+#include "Recorder.hpp"
 #include "PicoGFX.hpp"
 #include "ST7789.hpp"
+#include "Screen.hpp"
+#include "Background.hpp"
+#include "Pacer.hpp"
+#include "Backlight.hpp"
+#include "Idle.hpp"
+#include "GlyphCache.hpp"
+#include "Graph.hpp"
+#include "Strip.hpp"
+#include "Kernels.hpp"
+#include "Widget.hpp"
+#include "Panel.hpp"
+#include "Label.hpp"
+#include "Readout.hpp"
+#include "Bar.hpp"
+#include "Plot.hpp"
+#include "Pager.hpp"
+#include "Formatter.hpp"
+#include "Benchmark.hpp"
+#include "Profiler.hpp"
+#include "Placement.hpp"
+#include "Image.hpp"
 #include "RobotoMono24.font"
+#include "assets/background_image.h"
+#ifdef READOUT_FONT_ASSET
+#include "assets/readout_font.h"
+#else
 #include "RobotoMono48.font"
-#include "bg.h"
+#endif
 #include "test.h"
 
 /***
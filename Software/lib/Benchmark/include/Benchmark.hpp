@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+
+#define BENCHMARK_DEFAULT_ITERATIONS    1000
+#define BENCHMARK_HOOK_INTERVAL         50000   // us in between two calls of the hook
+
+typedef void (*Benchmark_Function)(void* context);
+
+class Benchmark
+{
+public:
+    Benchmark(unsigned int iterations = BENCHMARK_DEFAULT_ITERATIONS);
+
+    void setIterations(unsigned int iterations);
+    void setHook(Benchmark_Function hook, void* context = nullptr);
+    unsigned int run(Benchmark_Function function, void* context = nullptr);
+    unsigned int toMicroseconds(unsigned int cycles);
+private:
+    unsigned int iterations;
+    Benchmark_Function hook;
+    void* hookContext;
+
+    unsigned int callHook();
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+
+#ifndef PROFILER_MAX_STAGES
+#define PROFILER_MAX_STAGES     8           // stages that can be told apart
+#endif
+#define PROFILER_PERIOD         1000000     // microseconds covered by each set of results
+#define PROFILER_COUNTER_MASK   0xffffff    // the SysTick counter is 24 bits wide
+
+/**
+ * @brief The results of a stage over the last period
+ * @param min the fewest cycles spent in the stage in a single loop
+ * @param avg the average cycles per loop, over the loops that ran the stage
+ * @param max the most cycles spent in the stage in a single loop
+ * @param loops how many loops ran the stage
+*/
+struct Profiler_Stage
+{
+    unsigned int min;
+    unsigned int avg;
+    unsigned int max;
+    unsigned int loops;
+};
+
+class Profiler
+{
+public:
+    Profiler(unsigned int idle = PROFILER_MAX_STAGES - 1);
+    void init();
+
+    /**
+     * @brief Charge the time since the last probe to the current stage, and move on to the next
+     * @param stage the stage everything from here on belongs to
+     * @note This is the probe, a read of the SysTick counter and a few additions
+    */
+    inline void mark(unsigned int stage)
+    {
+        unsigned int now = systick_hw->cvr;
+        // the counter runs down
+        this->cycles[this->stage] += (this->last - now) & PROFILER_COUNTER_MASK;
+        this->last = now;
+        this->stage = stage;
+    }
+
+    /**
+     * @brief Step into a stage that interrupts the current one, until leave is called
+     * @param stage the nested stage
+     * @note Only one level deep, the stage that was interrupted is remembered
+    */
+    inline void enter(unsigned int stage)
+    {
+        this->outer = this->stage;
+        this->mark(stage);
+    }
+
+    /**
+     * @brief Go back to the stage that was interrupted by enter
+    */
+    inline void leave()
+    {
+        this->mark(this->outer);
+    }
+
+    bool commit();
+    Profiler_Stage getStage(unsigned int stage);
+    unsigned int getLoops();
+    unsigned int getOverhead();
+    unsigned int toMicroseconds(unsigned int cycles);
+private:
+    unsigned int last = 0;
+    unsigned int stage = 0;
+    unsigned int outer = 0;
+    unsigned int idle;
+    unsigned int cycles[PROFILER_MAX_STAGES] = {0};
+
+    // the period that is being gathered
+    unsigned int periodStart = 0;
+    unsigned int periodLoops = 0;
+    unsigned int minimum[PROFILER_MAX_STAGES] = {0};
+    unsigned int maximum[PROFILER_MAX_STAGES] = {0};
+    unsigned int count[PROFILER_MAX_STAGES] = {0};
+    unsigned long long sum[PROFILER_MAX_STAGES] = {0};
+
+    // the last complete period
+    Profiler_Stage results[PROFILER_MAX_STAGES] = {};
+    unsigned int loops = 0;
+    unsigned int overhead = 0;
+};
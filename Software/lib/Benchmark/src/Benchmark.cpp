@@ -0,0 +1,97 @@
+#include "Benchmark.hpp"
+
+/**
+ * @brief Construct a new Benchmark:: Benchmark object
+ * @param iterations how many times each function is called
+*/
+Benchmark::Benchmark(unsigned int iterations)
+{
+    this->hook = nullptr;
+    this->hookContext = nullptr;
+    this->setIterations(iterations);
+}
+
+/**
+ * @brief Set how many times each function is called
+ * @param iterations the number of calls, at least 1
+*/
+void Benchmark::setIterations(unsigned int iterations)
+{
+    this->iterations = MAX(1, iterations);
+}
+
+/**
+ * @brief Set a function to call every now and then during a run
+ * @param hook the function, nullptr for none
+ * @param context passed to the hook on every call
+ * @note Meant for whatever has to keep going while a benchmark runs, like the heartbeat of the
+ * task that runs it. The time spent in the hook is not counted.
+*/
+void Benchmark::setHook(Benchmark_Function hook, void* context)
+{
+    this->hook = hook;
+    this->hookContext = context;
+}
+
+/**
+ * @brief Time a function
+ * @param function the function to time
+ * @param context passed to the function on every call
+ * @return the average number of system clock cycles per call
+ * @note The M0+ has no cycle counter, so the cycles are worked out from the microsecond timer
+ * over all the iterations. Interrupts are left alone, so expect a bit of noise.
+*/
+unsigned int Benchmark::run(Benchmark_Function function, void* context)
+{
+    // one call up front, so the code and data are in the XIP cache before timing starts
+    function(context);
+    this->callHook();
+
+    unsigned int start = time_us_32();
+    if(this->hook == nullptr)
+    {
+        for(unsigned int i = 0; i < this->iterations; i++)
+            function(context);
+    }
+    else
+    {
+        // the hook is not timed, it only costs a read of the timer per call
+        unsigned int last = start;
+        for(unsigned int i = 0; i < this->iterations; i++)
+        {
+            function(context);
+            if(time_us_32() - last < BENCHMARK_HOOK_INTERVAL)
+                continue;
+            start += this->callHook();
+            last = time_us_32();
+        }
+    }
+    unsigned int elapsed = time_us_32() - start;
+
+    unsigned long long cycles = (unsigned long long)elapsed * (clock_get_hz(clk_sys) / 1000000);
+    return (unsigned int)(cycles / this->iterations);
+}
+
+/**
+ * @brief Call the hook, if there is one
+ * @return the time the hook took in microseconds
+*/
+unsigned int Benchmark::callHook()
+{
+    if(this->hook == nullptr)
+        return 0;
+
+    unsigned int start = time_us_32();
+    this->hook(this->hookContext);
+    return time_us_32() - start;
+}
+
+/**
+ * @brief Convert cycles to microseconds
+ * @param cycles the number of system clock cycles
+ * @return the time in microseconds
+*/
+unsigned int Benchmark::toMicroseconds(unsigned int cycles)
+{
+    return cycles / (clock_get_hz(clk_sys) / 1000000);
+}
@@ -0,0 +1,115 @@
+#include "Profiler.hpp"
+
+/**
+ * @brief Construct a new Profiler:: Profiler object
+ * @param idle the stage the time outside of the marked stages goes to
+*/
+Profiler::Profiler(unsigned int idle)
+{
+    this->idle = MIN(idle, PROFILER_MAX_STAGES - 1);
+    this->stage = this->idle;
+}
+
+/**
+ * @brief Start the SysTick counter and measure what a probe costs
+ * @note SysTick belongs to the core that calls this, so the probes have to run on that core.
+ * The counter wraps every 2^24 cycles, a single stage can not take longer than that.
+*/
+void Profiler::init()
+{
+    // free running from the processor clock, without the interrupt
+    systick_hw->csr = 0;
+    systick_hw->rvr = PROFILER_COUNTER_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;
+
+    // two probes back to back, whatever lands in between is the cost of one
+    this->mark(this->idle);
+    this->cycles[this->idle] = 0;
+    this->mark(this->idle);
+    this->overhead = this->cycles[this->idle];
+    this->cycles[this->idle] = 0;
+
+    this->periodStart = time_us_32();
+}
+
+/**
+ * @brief Close the loop, call this once per iteration of the main loop
+ * @return true if a period is complete and new results are available
+ * @note The time since the last probe goes to the current stage, the next loop starts in the idle stage.
+ * Stages that did not run in a loop are left out of its minimum and average.
+*/
+bool Profiler::commit()
+{
+    this->mark(this->idle);
+    this->periodLoops++;
+
+    for(unsigned int i = 0; i < PROFILER_MAX_STAGES; i++)
+    {
+        unsigned int cycles = this->cycles[i];
+        if(cycles == 0)
+            continue;
+
+        if(this->count[i] == 0 || cycles < this->minimum[i])
+            this->minimum[i] = cycles;
+        this->maximum[i] = MAX(this->maximum[i], cycles);
+        this->sum[i] += cycles;
+        this->count[i]++;
+        this->cycles[i] = 0;
+    }
+
+    if((time_us_32() - this->periodStart) < PROFILER_PERIOD)
+        return false;
+
+    for(unsigned int i = 0; i < PROFILER_MAX_STAGES; i++)
+    {
+        unsigned int count = this->count[i];
+        this->results[i] = { this->minimum[i], count > 0 ? (unsigned int)(this->sum[i] / count) : 0, this->maximum[i], count };
+        this->minimum[i] = this->maximum[i] = this->count[i] = 0;
+        this->sum[i] = 0;
+    }
+    this->loops = this->periodLoops;
+    this->periodLoops = 0;
+    this->periodStart = time_us_32();
+    return true;
+}
+
+/**
+ * @brief Get the results of a stage over the last period
+ * @param stage the stage
+ * @return the minimum, average and maximum in cycles, all zero if the stage did not run
+*/
+Profiler_Stage Profiler::getStage(unsigned int stage)
+{
+    if(stage >= PROFILER_MAX_STAGES)
+        return {};
+    return this->results[stage];
+}
+
+/**
+ * @brief Get the number of loops in the last period
+ * @return the loops per PROFILER_PERIOD
+*/
+unsigned int Profiler::getLoops()
+{
+    return this->loops;
+}
+
+/**
+ * @brief Get the cost of a single probe
+ * @return the cycles between two probes back to back, already part of every result
+*/
+unsigned int Profiler::getOverhead()
+{
+    return this->overhead;
+}
+
+/**
+ * @brief Convert cycles to microseconds
+ * @param cycles the number of system clock cycles
+ * @return the time in microseconds
+*/
+unsigned int Profiler::toMicroseconds(unsigned int cycles)
+{
+    return cycles / (clock_get_hz(clk_sys) / 1000000);
+}
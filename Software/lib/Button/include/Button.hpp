@@ -32,6 +32,7 @@ public:
     bool isHeld();
     bool isClicked();
     bool isLongPressed();
+    void clear();
 
     void update();
 private:
@@ -144,6 +144,14 @@ bool Button::isLongPressed()
     return state;
 }
 
+/**
+ * @brief Throw away the click, hold or long press that was not read yet
+*/
+void Button::clear()
+{
+    this->state = BUTTON_RELEASED;
+}
+
 /**
  * @brief Update the button state
 */
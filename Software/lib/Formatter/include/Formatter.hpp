@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "Placement.hpp"
+
+#define FORMATTER_DEFAULT_DIGITS    3
+#define FORMATTER_MAX_DIGITS        9
+#ifndef FORMATTER_MICRO
+#define FORMATTER_MICRO             'u'     // the fonts only cover ASCII, so no actual micro sign
+#endif
+
+class Formatter
+{
+public:
+    Formatter(unsigned int digits = FORMATTER_DEFAULT_DIGITS);
+
+    void setDigits(unsigned int digits);
+    unsigned int format(char* buffer, unsigned int length, int value, char unit);
+private:
+    unsigned int digits;
+};
@@ -0,0 +1,105 @@
+#include "Formatter.hpp"
+
+// powers of ten up to what fits in 32 bits
+static const unsigned int HOT_TABLE("formatter_powers") powersOfTen[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+// the prefixes from micro upwards, each one is a thousand times the previous one
+static const char HOT_TABLE("formatter_prefixes") prefixes[] = { FORMATTER_MICRO, 'm', '\0', 'k' };
+#define FORMATTER_PREFIX_COUNT  (sizeof(prefixes) / sizeof(prefixes[0]))
+#define FORMATTER_PREFIX_UNIT   2   // the prefix index of the unit itself
+
+/**
+ * @brief Construct a new Formatter:: Formatter object
+ * @param digits the number of significant digits
+*/
+Formatter::Formatter(unsigned int digits)
+{
+    this->setDigits(digits);
+}
+
+/**
+ * @brief Set the number of significant digits
+ * @param digits the number of significant digits, 1 through 9
+*/
+void Formatter::setDigits(unsigned int digits)
+{
+    this->digits = MAX(1, MIN(digits, FORMATTER_MAX_DIGITS));
+}
+
+/**
+ * @brief Format a value in engineering notation
+ * @param buffer the buffer to write the string to
+ * @param length the size of the buffer
+ * @param value the value in micro units, e.g. microvolts
+ * @param unit the unit character appended after the prefix
+ * @return the length of the string, or 0 if it did not fit in the buffer
+ * @note 12345678 with 3 digits and unit 'V' gives "12.3V", 999600 gives "1.00V" and -1500 gives "-1.50mV".
+ * Rounding is half away from zero. No heap, no floats and no printf.
+*/
+unsigned int HOT_FUNC(Formatter::format)(char* buffer, unsigned int length, int value, char unit)
+{
+    // work with the magnitude, the sign is added back at the end
+    unsigned int magnitude = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+
+    unsigned int prefix = 0;
+    unsigned int decimals = 0;
+    unsigned int rounded = 0;
+
+    // rounding can carry into another digit (9.996 -> 10.0), in that case the second pass picks the layout again
+    for(int pass = 0; pass < 2; pass++)
+    {
+        // pick the prefix that puts the integer part between 1 and 999, zero is shown without a prefix
+        prefix = magnitude == 0 ? FORMATTER_PREFIX_UNIT : 0;
+        unsigned int scale = powersOfTen[prefix * 3];
+        while(prefix < FORMATTER_PREFIX_COUNT - 1 && magnitude / scale >= 1000)
+        {
+            prefix++;
+            scale *= 1000;
+        }
+
+        unsigned int integer = magnitude / scale;
+        unsigned int integerDigits = integer >= 100 ? 3 : integer >= 10 ? 2 : 1;
+        decimals = this->digits > integerDigits ? this->digits - integerDigits : 0;
+        // micro units can not be split any further
+        decimals = MIN(decimals, prefix * 3);
+
+        unsigned int step = scale / powersOfTen[decimals];
+        rounded = (magnitude + step / 2) / step;
+
+        if(rounded < powersOfTen[integerDigits + decimals] || prefix == FORMATTER_PREFIX_COUNT - 1)
+            break;
+        magnitude = rounded * step;
+    }
+
+    // write the digits back to front, with at least one digit in front of the decimal point
+    char digits[FORMATTER_MAX_DIGITS + 2];
+    unsigned int count = 0;
+    do
+    {
+        digits[count++] = '0' + (rounded % 10);
+        rounded /= 10;
+    } while(rounded > 0 || count <= decimals);
+
+    // sign, digits, point, prefix, unit and terminator
+    bool negative = value < 0 && !(count == 1 && digits[0] == '0');
+    unsigned int total = negative + count + (decimals > 0) + (prefixes[prefix] != '\0') + 1;
+    if(total + 1 > length)
+        return 0;
+
+    char* output = buffer;
+    if(negative)
+        *output++ = '-';
+    while(count > 0)
+    {
+        if(count == decimals)
+            *output++ = '.';
+        *output++ = digits[--count];
+    }
+    if(prefixes[prefix] != '\0')
+        *output++ = prefixes[prefix];
+    *output++ = unit;
+    *output = '\0';
+
+    return output - buffer;
+}
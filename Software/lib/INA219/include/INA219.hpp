@@ -9,12 +9,16 @@
 #include <string.h>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
+#include "Placement.hpp"
 
 
 #define SHUNT_RESISTOR          0.01f       // 10mOhm
 #define CURRENT_RESOLUTION      0.001f      // 1mA/bit
 #define SHUNT_VOLTAGE_LSB_VALUE 0.00001f    // 10uV
 #define BUS_VOLTAGE_LSB_VALUE   0.004f      // 4mV
+#define CURRENT_LSB_MICRO       1000        // 1mA/bit in microamps
+#define POWER_LSB_MICRO         20000       // 20 times the current LSB in microwatts
+#define BUS_VOLTAGE_LSB_MICRO   4000        // 4mV in microvolts
 
 #define INA219_ERROR_OK                "No errors!"
 #define INA219_ERROR_CONFIG            "Configuration register error!"
@@ -53,6 +57,10 @@ public:
     double getCurrent();
     double getPower();
 
+    int getVoltageMicro();
+    int getCurrentMicro();
+    int getPowerMicro();
+
     unsigned short getCalibration();
     void setCalibration(unsigned short cal);
     void setCalibration();
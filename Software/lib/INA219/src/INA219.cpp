@@ -14,7 +14,7 @@ INA219::INA219(unsigned int register_address, i2c_inst_t* i2c)
 /**
  * @brief get the data off the INA219
 */
-void INA219::getData(bool all)
+void HOT_FUNC(INA219::getData)(bool all)
 {
     this->data.shuntVoltage = readWord(INA219_SHUNT_VOLTAGE_ADDR);
     this->data.busVoltage = readWord(INA219_BUS_VOLTAGE_ADDR);
@@ -156,7 +156,7 @@ unsigned short INA219::getShuntVoltageRaw()
  * @brief get the bus raw value
  * @return the bus raw value
 */
-unsigned short INA219::getBusVoltageRaw()
+unsigned short HOT_FUNC(INA219::getBusVoltageRaw)()
 {
     // check if the bus voltage is valid, if not return 0
     if(this->data.busVoltage.OVF)
@@ -178,7 +178,7 @@ unsigned short INA219::getPowerRaw()
  * @brief get the current raw value
  * @return the current raw value
 */
-unsigned short INA219::getCurrentRaw()
+unsigned short HOT_FUNC(INA219::getCurrentRaw)()
 {
     return this->data.current;
 }
@@ -256,6 +256,38 @@ double INA219::getPower()
     return power * 1000;
 }
 
+/**
+ * @brief get the bus voltage in fixed point
+ * @return the bus voltage in microvolts
+*/
+int INA219::getVoltageMicro()
+{
+    return this->getBusVoltageRaw() * BUS_VOLTAGE_LSB_MICRO;
+}
+
+/**
+ * @brief get the current in fixed point
+ * @return the current in microamps
+*/
+int HOT_FUNC(INA219::getCurrentMicro)()
+{
+    unsigned short current = this->getCurrentRaw();
+    // same bug as in getCurrent, the chip outputs close to UINT16_MAX when the current is 0
+    if(current > (UINT16_MAX - 100))
+        return 0;
+
+    return current * CURRENT_LSB_MICRO;
+}
+
+/**
+ * @brief get the power in fixed point
+ * @return the power in microwatts
+*/
+int INA219::getPowerMicro()
+{
+    return this->getPowerRaw() * POWER_LSB_MICRO;
+}
+
 /**
  * @brief get the calibration register
  * @return the calibration register
@@ -516,7 +548,7 @@ unsigned int INA219::countSetBits(unsigned int number)
  * @param data the buffer to store the data in
  * @note as the RP2040 is a 32 bit microcontroller, a word is 4 bytes
 */
-unsigned short INA219::readWord(unsigned char register_address)
+unsigned short HOT_FUNC(INA219::readWord)(unsigned char register_address)
 {
     // create a two byte buffer to store the data in
     unsigned char buffer[2];
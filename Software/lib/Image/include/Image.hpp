@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+
+#define IMAGE_MAGIC         0x35363551  // "Q565"
+
+#define IMAGE_OP_INDEX      0x00        // 00xxxxxx, index into the table of recently seen colors
+#define IMAGE_OP_DIFF       0x40        // 01rrggbb, small difference to the previous pixel
+#define IMAGE_OP_LUMA       0x80        // 10gggggg rrrrbbbb, green difference with red and blue relative to it
+#define IMAGE_OP_RUN        0xc0        // 11xxxxxx, repeat the previous pixel 1 through 62 times
+#define IMAGE_OP_RGB        0xfe        // followed by the pixel, little endian
+#define IMAGE_OP_MASK       0xc0
+
+/**
+ * @brief The header in front of the compressed pixels
+ * @param magic IMAGE_MAGIC
+ * @param width the width of the image in pixels
+ * @param height the height of the image in pixels
+ * @param bandHeight the number of rows in each band
+ * @param bandCount the number of bands
+ * @param dataSize the size of the compressed pixels in bytes
+ * @note The header is followed by the offset of each band into the compressed pixels
+*/
+struct Image_Header
+{
+    unsigned int magic;
+    unsigned short width;
+    unsigned short height;
+    unsigned short bandHeight;
+    unsigned short bandCount;
+    unsigned int dataSize;
+};
+
+class Image
+{
+public:
+    Image(const unsigned char* data, unsigned int size);
+
+    bool isValid();
+    unsigned int getWidth();
+    unsigned int getHeight();
+
+    void draw(unsigned short* frameBuffer, unsigned int stride);
+    void draw(unsigned short* frameBuffer, unsigned int stride, unsigned int x, unsigned int y, unsigned int width, unsigned int height);
+private:
+    const Image_Header* header;
+    const unsigned int* offsets;
+    const unsigned char* pixels;
+    bool valid = false;
+
+    void decodeBand(unsigned int band, unsigned short* frameBuffer, unsigned int stride,
+        unsigned int x, unsigned int y, unsigned int width, unsigned int height);
+};
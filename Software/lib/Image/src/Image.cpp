@@ -0,0 +1,178 @@
+#include "Image.hpp"
+
+/**
+ * @brief Construct a new Image:: Image object
+ * @param data the compressed image, as written by the image converter
+ * @param size the size of the compressed image in bytes
+*/
+Image::Image(const unsigned char* data, unsigned int size)
+{
+    this->header = (const Image_Header*)data;
+    this->offsets = (const unsigned int*)(data + sizeof(Image_Header));
+    this->pixels = nullptr;
+
+    // make sure the header and the table of band offsets fit in the data, before reading any further
+    if(size < sizeof(Image_Header) || this->header->magic != IMAGE_MAGIC || this->header->bandHeight == 0 ||
+        this->header->bandCount != (this->header->height + this->header->bandHeight - 1) / this->header->bandHeight ||
+        sizeof(Image_Header) + this->header->bandCount * sizeof(unsigned int) + this->header->dataSize > size)
+        return;
+    this->pixels = (const unsigned char*)(this->offsets + this->header->bandCount);
+
+    // every band has to start inside the compressed pixels, the decoder trusts the offsets
+    for(unsigned int band = 0; band < this->header->bandCount; band++)
+    {
+        if(this->offsets[band] >= this->header->dataSize)
+            return;
+    }
+
+    this->valid = true;
+}
+
+/**
+ * @brief Check if the image could be read
+ * @return true if the header is valid
+*/
+bool Image::isValid()
+{
+    return this->valid;
+}
+
+/**
+ * @brief Get the width of the image
+ * @return the width in pixels
+*/
+unsigned int Image::getWidth()
+{
+    return this->valid ? this->header->width : 0;
+}
+
+/**
+ * @brief Get the height of the image
+ * @return the height in pixels
+*/
+unsigned int Image::getHeight()
+{
+    return this->valid ? this->header->height : 0;
+}
+
+/**
+ * @brief Decode the entire image into the frame buffer
+ * @param frameBuffer where the top left pixel of the image goes
+ * @param stride the width of the frame buffer in pixels
+*/
+void Image::draw(unsigned short* frameBuffer, unsigned int stride)
+{
+    this->draw(frameBuffer, stride, 0, 0, this->getWidth(), this->getHeight());
+}
+
+/**
+ * @brief Decode an area of the image into the frame buffer
+ * @param frameBuffer where the top left pixel of the area goes
+ * @param stride the width of the frame buffer in pixels
+ * @param x the left edge of the area in the image
+ * @param y the top edge of the area in the image
+ * @param width the width of the area in pixels
+ * @param height the height of the area in pixels
+ * @note Only the bands the area touches are decoded, the pixels are written straight into the frame buffer
+*/
+void Image::draw(unsigned short* frameBuffer, unsigned int stride, unsigned int x, unsigned int y, unsigned int width, unsigned int height)
+{
+    if(!this->valid || x >= this->header->width || y >= this->header->height)
+        return;
+    width = MIN(width, this->header->width - x);
+    height = MIN(height, this->header->height - y);
+
+    unsigned int first = y / this->header->bandHeight;
+    unsigned int last = (y + height - 1) / this->header->bandHeight;
+    for(unsigned int band = first; band <= last; band++)
+        this->decodeBand(band, frameBuffer, stride, x, y, width, height);
+}
+
+/**
+ * @private
+ * @brief Decode a band and keep the pixels that fall inside the area
+ * @param band the index of the band
+ * @param frameBuffer where the top left pixel of the area goes
+ * @param stride the width of the frame buffer in pixels
+ * @param x the left edge of the area in the image
+ * @param y the top edge of the area in the image
+ * @param width the width of the area in pixels
+ * @param height the height of the area in pixels
+*/
+void Image::decodeBand(unsigned int band, unsigned short* frameBuffer, unsigned int stride,
+    unsigned int x, unsigned int y, unsigned int width, unsigned int height)
+{
+    const unsigned char* data = this->pixels + this->offsets[band];
+    const unsigned char* end = this->pixels + this->header->dataSize;
+
+    // every band starts from scratch, so it can be decoded on its own
+    unsigned short table[64] = {0};
+    unsigned short pixel = 0;
+    unsigned int run = 0;
+
+    unsigned int imageWidth = this->header->width;
+    unsigned int top = band * this->header->bandHeight;
+    unsigned int bottom = MIN(top + this->header->bandHeight, y + height);
+    unsigned int column = 0;
+    unsigned int row = top;
+
+    while(row < bottom)
+    {
+        if(run > 0)
+            run--;
+        else if(data < end)
+        {
+            unsigned char op = *data++;
+            unsigned int r = (pixel >> 11) & 0x1f;
+            unsigned int g = (pixel >> 5) & 0x3f;
+            unsigned int b = pixel & 0x1f;
+
+            if(op == IMAGE_OP_RGB)
+            {
+                // a pixel cut off at the end of the data ends the band, like running out of ops does
+                if(end - data < 2)
+                    data = end;
+                else
+                {
+                    pixel = data[0] | (data[1] << 8);
+                    data += 2;
+                }
+            }
+            else if((op & IMAGE_OP_MASK) == IMAGE_OP_INDEX)
+                pixel = table[op];
+            else if((op & IMAGE_OP_MASK) == IMAGE_OP_DIFF)
+            {
+                r = (r + ((op >> 4) & 0x03) - 2) & 0x1f;
+                g = (g + ((op >> 2) & 0x03) - 2) & 0x3f;
+                b = (b + (op & 0x03) - 2) & 0x1f;
+                pixel = (r << 11) | (g << 5) | b;
+            }
+            else if((op & IMAGE_OP_MASK) == IMAGE_OP_LUMA)
+            {
+                // red and blue only have half the resolution of green
+                int dg = (int)(op & 0x3f) - 32;
+                unsigned char second = data < end ? *data++ : 0x88;
+                r = (r + (dg >> 1) + (second >> 4) - 8) & 0x1f;
+                b = (b + (dg >> 1) + (second & 0x0f) - 8) & 0x1f;
+                g = (g + dg) & 0x3f;
+                pixel = (r << 11) | (g << 5) | b;
+            }
+            else
+                run = op & 0x3f;
+
+            // runs repeat the previous pixel, which is already in the table
+            if((op & IMAGE_OP_MASK) != IMAGE_OP_RUN || op == IMAGE_OP_RGB)
+                table[((pixel >> 11) * 3 + ((pixel >> 5) & 0x3f) * 5 + (pixel & 0x1f) * 7) & 0x3f] = pixel;
+        }
+
+        // keep the pixel if it falls inside the area
+        if(row >= y && column >= x && column < x + width)
+            frameBuffer[(row - y) * stride + (column - x)] = pixel;
+
+        if(++column == imageWidth)
+        {
+            column = 0;
+            row++;
+        }
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+class Lockout
+{
+public:
+    void request();
+    bool isRequested();
+    bool isParked();
+    void release();
+    void park();
+private:
+    volatile bool requested = false;
+    volatile bool parked = false;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+
+#define MAILBOX_COMMAND_SHIFT       24          // the command in the top byte of the word
+#define MAILBOX_ARGUMENT_MASK       0xffffff    // and its argument in the rest
+
+class Mailbox
+{
+public:
+    bool post(unsigned int command, unsigned int argument = 0);
+    bool receive(unsigned int* command, unsigned int* argument);
+    unsigned int getDropped();
+private:
+    unsigned int dropped = 0;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+#define MEASUREMENT_SERIES      3       // voltage, current and power
+
+/**
+ * @brief What the publisher gathered over all of its samples since it last started over
+ * @param minimum the minimum of every series
+ * @param maximum the maximum of every series
+ * @param sum the sum of every series, divided by count for the average
+ * @param count the number of samples gathered
+ * @param energy the power integrated over time, in microwatt milliseconds
+ * @param charge the current integrated over time, in microamp milliseconds
+*/
+struct Measurement_Statistics
+{
+    int minimum[MEASUREMENT_SERIES];
+    int maximum[MEASUREMENT_SERIES];
+    long long sum[MEASUREMENT_SERIES];
+    unsigned int count;
+    long long energy;
+    long long charge;
+};
+
+/**
+ * @brief A sample as the control core took it, along with the state it was taken in
+ * @param version counts the publishes, set by publish(), 0 until the first one
+ * @param time the time the sample was taken, in microseconds
+ * @param flags the state of whatever the sample is about, the bits are up to the publisher
+ * @param voltage the bus voltage in microvolts
+ * @param current the current in microamps
+ * @param power the power in microwatts
+ * @param busVoltageRaw the raw bus voltage register of the INA219
+ * @param shuntVoltageRaw the raw shunt voltage register of the INA219
+ * @param currentRaw the raw current register of the INA219
+ * @param powerRaw the raw power register of the INA219
+ * @param statistics gathered over every sample up to this one, so the readers do not miss the ones in between
+*/
+struct Measurement_Sample
+{
+    unsigned int version;
+    unsigned int time;
+    unsigned int flags;
+    int voltage;
+    int current;
+    int power;
+    unsigned short busVoltageRaw;
+    unsigned short shuntVoltageRaw;
+    unsigned short currentRaw;
+    unsigned short powerRaw;
+    Measurement_Statistics statistics;
+};
+
+class Measurement
+{
+public:
+    void publish(Measurement_Sample* sample);
+    Measurement_Sample read();
+    unsigned int getVersion();
+private:
+    // odd while the first copy is being written, the readers take the second one meanwhile
+    volatile unsigned int sequence = 0;
+    Measurement_Sample samples[2] = {};
+};
@@ -0,0 +1,54 @@
+#include "Lockout.hpp"
+
+/**
+ * @brief Ask the other core to get out of the flash
+ * @note Wait for isParked() before erasing or programming the flash
+*/
+void Lockout::request()
+{
+    this->requested = true;
+    __sev();
+}
+
+/**
+ * @brief Check whether the other core asked this one to park
+ * @return true if park() should be called
+*/
+bool Lockout::isRequested()
+{
+    return this->requested;
+}
+
+/**
+ * @brief Check whether the other core is parked
+ * @return true once the other core runs from SRAM with its interrupts disabled
+*/
+bool Lockout::isParked()
+{
+    return this->parked;
+}
+
+/**
+ * @brief Let the parked core go again
+*/
+void Lockout::release()
+{
+    this->requested = false;
+    __sev();
+}
+
+/**
+ * @brief Sit in SRAM with the interrupts disabled until the other core is done with the flash
+ * @note Runs from SRAM, as does everything it calls, so the flash can be erased under it
+*/
+void __not_in_flash_func(Lockout::park)()
+{
+    unsigned int interrupts = save_and_disable_interrupts();
+    this->parked = true;
+
+    while(this->requested)
+        __wfe();
+
+    this->parked = false;
+    restore_interrupts(interrupts);
+}
@@ -0,0 +1,46 @@
+#include "Mailbox.hpp"
+
+/**
+ * @brief Send a command to the other core
+ * @param command the command, up to 255
+ * @param argument passed along with the command, up to 24 bits
+ * @return true if the command went out, false if the FIFO was full and the command was dropped
+ * @note Never waits, so the sending core keeps its timing no matter how busy the other one is
+*/
+bool Mailbox::post(unsigned int command, unsigned int argument)
+{
+    if(!multicore_fifo_wready())
+    {
+        this->dropped++;
+        return false;
+    }
+
+    multicore_fifo_push_blocking((command << MAILBOX_COMMAND_SHIFT) | (argument & MAILBOX_ARGUMENT_MASK));
+    return true;
+}
+
+/**
+ * @brief Take the next command the other core sent
+ * @param command where the command goes
+ * @param argument where its argument goes
+ * @return true if there was a command, false if the FIFO is empty
+*/
+bool Mailbox::receive(unsigned int* command, unsigned int* argument)
+{
+    if(!multicore_fifo_rvalid())
+        return false;
+
+    unsigned int word = multicore_fifo_pop_blocking();
+    *command = word >> MAILBOX_COMMAND_SHIFT;
+    *argument = word & MAILBOX_ARGUMENT_MASK;
+    return true;
+}
+
+/**
+ * @brief Get the number of commands dropped because the FIFO was full
+ * @return the number of commands since boot
+*/
+unsigned int Mailbox::getDropped()
+{
+    return this->dropped;
+}
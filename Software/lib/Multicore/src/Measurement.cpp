@@ -0,0 +1,58 @@
+#include "Measurement.hpp"
+
+/**
+ * @brief Hand a new sample to the readers
+ * @param sample the sample, its version is filled in
+ * @note Only a single core may publish. The sample is written twice, one copy at a time, so
+ * there is always a complete copy for the readers to take.
+*/
+void Measurement::publish(Measurement_Sample* sample)
+{
+    unsigned int sequence = this->sequence;
+    sample->version = sequence / 2 + 1;
+
+    // the readers move over to the second copy, which still holds the last sample
+    this->sequence = sequence + 1;
+    __dmb();
+    this->samples[0] = *sample;
+    __dmb();
+
+    // and back to the first one, while the second one catches up
+    this->sequence = sequence + 2;
+    __dmb();
+    this->samples[1] = *sample;
+}
+
+/**
+ * @brief Get the latest sample, all of its values from the same publish
+ * @return the sample
+ * @note Never waits for a publish in progress, the copy that is read is never the one being written.
+ * It only reads again if a publish went by during the copy, which can not happen in an interrupt on
+ * the core that publishes, and on the other core only once per publish. Safe from anywhere.
+*/
+Measurement_Sample Measurement::read()
+{
+    Measurement_Sample sample;
+    unsigned int sequence;
+
+    do
+    {
+        sequence = this->sequence;
+        __dmb();
+        sample = this->samples[sequence & 1];
+        __dmb();
+    } while(sequence != this->sequence);
+
+    return sample;
+}
+
+/**
+ * @brief Get the version of the latest sample, without reading all of it
+ * @return the version, 0 until the first publish
+ * @note Compare it with the version of the last sample read to tell whether there is a new one
+*/
+unsigned int Measurement::getVersion()
+{
+    // halfway through a publish the readers still get the last one
+    return this->sequence / 2;
+}
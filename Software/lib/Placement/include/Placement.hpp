@@ -0,0 +1,27 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+/*
+    Placement of the hot paths, enabled with the HOT_RAM build option.
+
+    HOT_FUNC wraps the name of a function in its definition, the function is then copied to SRAM
+    at boot and runs without going through the XIP cache:
+        void HOT_FUNC(INA219::getData)(bool all)
+
+    HOT_TABLE goes between the type and the name of a table, the table is then copied to the
+    scratch X bank at boot. Every table needs a group name of its own:
+        static const unsigned int HOT_TABLE("powers") powersOfTen[] = { ... };
+
+    Scratch X is 4kB, the upper half holds the stack of core 1. Keep the tables small.
+*/
+
+#ifdef HOT_RAM
+#define HOT_RAM_ENABLED     1
+#define HOT_FUNC(name)      __not_in_flash_func(name)
+#define HOT_TABLE(group)    __scratch_x(group)
+#else
+#define HOT_RAM_ENABLED     0
+#define HOT_FUNC(name)      name
+#define HOT_TABLE(group)
+#endif
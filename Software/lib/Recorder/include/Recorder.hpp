@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+
+#define RECORDER_SAMPLES        256         // has to be a power of two
+#define RECORDER_MAGIC          0x46524543  // "FREC"
+#define RECORDER_HEADER_SIZE    FLASH_PAGE_SIZE
+
+/**
+ * @brief A single sample as read from the INA219
+ * @param voltage the raw bus voltage
+ * @param current the raw current
+*/
+struct Recorder_Sample
+{
+    unsigned short voltage;
+    unsigned short current;
+};
+
+/**
+ * @brief The metadata stored in front of the samples
+ * @param magic RECORDER_MAGIC if the record is valid
+ * @param tripCount how many trips have been recorded since the flash was erased
+ * @param tripTime the time of the trip in microseconds since boot
+ * @param samplePeriod the average time between two samples in microseconds
+ * @param tripCurrent the current that tripped the fuse in milliamps
+ * @param tripLimit the trip current limit in milliamps
+ * @param sampleCount the number of valid samples, oldest first
+ * @param checksum sum of all the words above
+*/
+struct Recorder_Trip
+{
+    unsigned int magic;
+    unsigned int tripCount;
+    unsigned int tripTime;
+    unsigned int samplePeriod;
+    unsigned int tripCurrent;
+    unsigned int tripLimit;
+    unsigned int sampleCount;
+    unsigned int checksum;
+};
+
+class Recorder
+{
+public:
+    Recorder(unsigned int flashOffset);
+
+    void push(unsigned short voltage, unsigned short current);
+    void freeze(unsigned int tripCurrent, unsigned int tripLimit);
+    void resume();
+    bool isPending();
+    void persist();
+
+    bool hasRecord();
+    const Recorder_Trip* getRecord();
+    Recorder_Sample getSample(unsigned int index);
+private:
+    unsigned int flashOffset;
+    Recorder_Sample samples[RECORDER_SAMPLES];
+    unsigned int lastSampleTime = 0;
+    unsigned int samplePeriod = 0;
+    unsigned int head = 0;
+    unsigned int count = 0;
+    bool frozen = false;
+    bool pending = false;
+    Recorder_Trip trip;
+
+    unsigned int checksum(const Recorder_Trip* trip);
+};
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "Recorder.hpp"
+
+/**
+ * @brief Construct a new Recorder:: Recorder object
+ * @param flashOffset the offset of the flash sector reserved for the record, has to be sector aligned
+*/
+Recorder::Recorder(unsigned int flashOffset)
+{
+    this->flashOffset = flashOffset;
+}
+
+/**
+ * @brief Add a sample to the ring
+ * @param voltage the raw bus voltage
+ * @param current the raw current
+ * @note The oldest sample is overwritten, nothing is recorded while frozen
+*/
+void Recorder::push(unsigned short voltage, unsigned short current)
+{
+    if(this->frozen)
+        return;
+
+    // keep a running average of the sample period, the host needs it to rebuild the time axis
+    unsigned int now = time_us_32();
+    if(this->count > 0)
+        this->samplePeriod = (this->samplePeriod * 7 + (now - this->lastSampleTime)) / 8;
+    this->lastSampleTime = now;
+
+    this->samples[this->head] = { voltage, current };
+    this->head = (this->head + 1) & (RECORDER_SAMPLES - 1);
+    if(this->count < RECORDER_SAMPLES)
+        this->count++;
+}
+
+/**
+ * @brief Freeze the ring and mark it for persisting
+ * @param tripCurrent the current that tripped the fuse in milliamps
+ * @param tripLimit the trip current limit in milliamps
+ * @note This only copies a few words, the slow part is left for persist()
+*/
+void Recorder::freeze(unsigned int tripCurrent, unsigned int tripLimit)
+{
+    if(this->frozen)
+        return;
+
+    this->frozen = true;
+    this->pending = true;
+
+    this->trip.magic = RECORDER_MAGIC;
+    this->trip.tripTime = time_us_32();
+    this->trip.samplePeriod = this->samplePeriod;
+    this->trip.tripCurrent = tripCurrent;
+    this->trip.tripLimit = tripLimit;
+    this->trip.sampleCount = this->count;
+}
+
+/**
+ * @brief Start recording again after a trip
+ * @note A record that has not been persisted yet is dropped
+*/
+void Recorder::resume()
+{
+    this->frozen = false;
+    this->pending = false;
+    this->head = 0;
+    this->count = 0;
+}
+
+/**
+ * @brief Check if there is a frozen record waiting to be persisted
+ * @return true if persist() should be called
+*/
+bool Recorder::isPending()
+{
+    return this->pending;
+}
+
+/**
+ * @brief Write the frozen record to flash
+ * @note This blocks with the interrupts disabled while the sector is erased and programmed,
+ * it must only be called once the output is already turned off!
+*/
+void Recorder::persist()
+{
+    if(!this->pending)
+        return;
+
+    // carry on counting from the previous record
+    this->trip.tripCount = this->hasRecord() ? this->getRecord()->tripCount + 1 : 1;
+    this->trip.checksum = this->checksum(&this->trip);
+
+    // the flash can only be programmed in full pages, so assemble one page at a time
+    unsigned char page[FLASH_PAGE_SIZE];
+    unsigned int samplesPerPage = FLASH_PAGE_SIZE / sizeof(Recorder_Sample);
+    // the oldest sample sits right after the head once the ring has wrapped
+    unsigned int tail = (this->head - this->count) & (RECORDER_SAMPLES - 1);
+
+    unsigned int interrupts = save_and_disable_interrupts();
+
+    flash_range_erase(this->flashOffset, FLASH_SECTOR_SIZE);
+
+    // header page
+    memset(page, 0xff, sizeof(page));
+    memcpy(page, &this->trip, sizeof(this->trip));
+    flash_range_program(this->flashOffset, page, FLASH_PAGE_SIZE);
+
+    // sample pages, oldest first
+    for(unsigned int offset = 0; offset < this->count; offset += samplesPerPage)
+    {
+        Recorder_Sample* pageSamples = (Recorder_Sample*)page;
+        memset(page, 0xff, sizeof(page));
+        for(unsigned int i = 0; i < samplesPerPage && (offset + i) < this->count; i++)
+            pageSamples[i] = this->samples[(tail + offset + i) & (RECORDER_SAMPLES - 1)];
+
+        flash_range_program(this->flashOffset + RECORDER_HEADER_SIZE + offset * sizeof(Recorder_Sample),
+            page, FLASH_PAGE_SIZE);
+    }
+
+    restore_interrupts(interrupts);
+
+    this->pending = false;
+}
+
+/**
+ * @brief Check if the flash holds a valid record
+ * @return true if a valid record was found
+*/
+bool Recorder::hasRecord()
+{
+    const Recorder_Trip* record = this->getRecord();
+    return record->magic == RECORDER_MAGIC &&
+        record->sampleCount <= RECORDER_SAMPLES &&
+        record->checksum == this->checksum(record);
+}
+
+/**
+ * @brief Get the record stored in flash
+ * @return pointer to the record metadata, check hasRecord() before trusting it
+*/
+const Recorder_Trip* Recorder::getRecord()
+{
+    return (const Recorder_Trip*)(XIP_BASE + this->flashOffset);
+}
+
+/**
+ * @brief Get a sample from the record stored in flash
+ * @param index the index of the sample, 0 is the oldest
+ * @return the sample, or all ones if the index is out of range
+*/
+Recorder_Sample Recorder::getSample(unsigned int index)
+{
+    if(!this->hasRecord() || index >= this->getRecord()->sampleCount)
+        return { 0xffff, 0xffff };
+
+    const Recorder_Sample* samples = (const Recorder_Sample*)(XIP_BASE + this->flashOffset + RECORDER_HEADER_SIZE);
+    return samples[index];
+}
+
+/**
+ * @private
+ * @brief Calculate the checksum of the metadata
+ * @param trip the metadata
+ * @return the sum of all the words in front of the checksum
+*/
+unsigned int Recorder::checksum(const Recorder_Trip* trip)
+{
+    const unsigned int* words = (const unsigned int*)trip;
+    unsigned int sum = 0;
+    for(unsigned int i = 0; i < (sizeof(Recorder_Trip) / sizeof(unsigned int)) - 1; i++)
+        sum += words[i];
+    return sum;
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #define Device_Ping_Default 0x45U
 #define Device_Target_Voltage_Default 0x1388U
 #define Device_Target_Current_Default 0x1f4U
+#define Device_Benchmark_Default 0x00U
 
 /*
     Default values for the INA219
@@ -24,6 +25,11 @@
 #define Display_Brightness_Limit_Default 0x64U
 #define Display_Background_Color_Default 0x00U
 #define Display_Text_Color_Default __UINT32_MAX__
+#define Display_Max_FPS_Default 0x1eU
+#define Display_Debug_Overlay_Default 0x00U
+#define Display_Dim_Timeout_Default 0x3cU
+#define Display_Sleep_Timeout_Default 0xf0U
+#define Display_Dim_Brightness_Default 0x14U
 
 /*
     Default values for the programmable fuse
@@ -31,6 +37,7 @@
 
 #define PFuse_Warning_Current_Default 0x3e8
 #define PFuse_Trip_Current_Default 0xbb8
+#define PFuse_Record_Page_Default 0x00
 
 /*
     0x00 through 0x0f are reserved for device control
@@ -43,12 +50,18 @@
 typedef enum : unsigned int
 {
     Device_Ping                 = 0x00,
+    Device_Loop_Timing          = 0x01,
+    Device_Task_Timing          = 0x02,
     Device_Reset                = 0x05,
     Device_Reboot_Bootloader    = 0x06,
     Device_Self_Test            = 0x07,
     Device_Self_Test_Result     = 0x08,
     Device_Target_Voltage       = 0x09,
     Device_Target_Current       = 0x0A,
+    Device_Reset_Reason         = 0x0B,
+    Device_Stalled_Task         = 0x0C,
+    Device_Benchmark            = 0x0D,
+    Device_Benchmark_Result     = 0x0E,
     Git_Hash                    = 0x0F,
 
     Bus_Voltage                 = 0x10,
@@ -63,10 +76,22 @@ typedef enum : unsigned int
     Display_Brightness_Limit    = 0x21,
     Display_Background_Color    = 0x22,
     Display_Text_Color          = 0x23,
+    Display_Frame_Timing        = 0x24,
+    Display_Max_FPS             = 0x25,
+    Display_Render_Load         = 0x26,
+    Display_Debug_Overlay       = 0x27,
+    Display_Dim_Timeout         = 0x28,
+    Display_Sleep_Timeout       = 0x29,
+    Display_Dim_Brightness      = 0x2A,
+    Display_Power_State         = 0x2B,
+    Display_Power_Current       = 0x2C,
 
     PFuse_Status                = 0x30,
     PFuse_Warning_Current       = 0x31,
     PFuse_Trip_Current          = 0x32,
+    PFuse_Record_Info           = 0x33,
+    PFuse_Record_Page           = 0x34,
+    PFuse_Record_Data           = 0x35,
 
     USB_PD_Status               = 0x40,
     USB_PD_IsPD                 = 0x41,
@@ -140,12 +165,18 @@ public:
 struct RegisterMap
 {
     Register Device_Ping                    = Register(RegisterType::ReadOnly, Device_Ping_Default);
+    RegisterArray Device_Loop_Timing        = RegisterArray(RegisterType::ReadOnly);
+    RegisterArray Device_Task_Timing        = RegisterArray(RegisterType::ReadOnly);
     Register Device_Reset                   = Register(RegisterType::WriteOnly);
     Register Device_Reboot_Bootloader       = Register(RegisterType::WriteOnly);
     Register Device_Self_Test               = Register(RegisterType::WriteOnly);
     RegisterArray Device_Self_Test_Result   = RegisterArray(RegisterType::ReadOnly);
     Register Device_Target_Voltage          = Register(RegisterType::Default, Device_Target_Voltage_Default);
     Register Device_Target_Current          = Register(RegisterType::Default, Device_Target_Current_Default);
+    Register Device_Reset_Reason            = Register(RegisterType::ReadOnly);
+    Register Device_Stalled_Task            = Register(RegisterType::ReadOnly);
+    Register Device_Benchmark               = Register(RegisterType::WriteOnly, Device_Benchmark_Default);
+    RegisterArray Device_Benchmark_Result   = RegisterArray(RegisterType::ReadOnly);
     RegisterArray Git_Hash                  = RegisterArray(RegisterType::ReadOnly);
 
     Register Bus_Voltage                    = Register(RegisterType::ReadOnly);
@@ -160,10 +191,22 @@ struct RegisterMap
     Register Display_Brightness_Limit       = Register(RegisterType::Default, Display_Brightness_Limit_Default);
     Register Display_Background_Color       = Register(RegisterType::Default, Display_Background_Color_Default);
     Register Display_Text_Color             = Register(RegisterType::Default, Display_Text_Color_Default);
+    RegisterArray Display_Frame_Timing      = RegisterArray(RegisterType::ReadOnly);
+    Register Display_Max_FPS                = Register(RegisterType::Default, Display_Max_FPS_Default);
+    Register Display_Render_Load            = Register(RegisterType::ReadOnly);
+    Register Display_Debug_Overlay          = Register(RegisterType::Default, Display_Debug_Overlay_Default);
+    Register Display_Dim_Timeout            = Register(RegisterType::Default, Display_Dim_Timeout_Default);
+    Register Display_Sleep_Timeout          = Register(RegisterType::Default, Display_Sleep_Timeout_Default);
+    Register Display_Dim_Brightness         = Register(RegisterType::Default, Display_Dim_Brightness_Default);
+    Register Display_Power_State            = Register(RegisterType::ReadOnly);
+    RegisterArray Display_Power_Current     = RegisterArray(RegisterType::ReadOnly);
 
     Register PFuse_Status                   = Register(RegisterType::ReadOnly);
     Register PFuse_Warning_Current          = Register(RegisterType::Default, PFuse_Warning_Current_Default);
     Register PFuse_Trip_Current             = Register(RegisterType::Default, PFuse_Trip_Current_Default);
+    RegisterArray PFuse_Record_Info         = RegisterArray(RegisterType::ReadOnly);
+    Register PFuse_Record_Page              = Register(RegisterType::Default, PFuse_Record_Page_Default);
+    RegisterArray PFuse_Record_Data         = RegisterArray(RegisterType::ReadOnly);
 
     Register USB_PD_Status                  = Register(RegisterType::ReadOnly);
     Register USB_PD_IsPD                    = Register(RegisterType::ReadOnly);
@@ -191,18 +234,38 @@ struct RegisterMap
         Display_Brightness_Limit.reset();
         Display_Background_Color.reset();
         Display_Text_Color.reset();
+        Display_Max_FPS.reset();
+        Display_Debug_Overlay.reset();
+        Display_Dim_Timeout.reset();
+        Display_Sleep_Timeout.reset();
+        Display_Dim_Brightness.reset();
         PFuse_Warning_Current.reset();
         PFuse_Trip_Current.reset();
+        PFuse_Record_Page.reset();
     }
 
     RegisterArray* getRegisterArray(Register_Address address)
     {
         switch(address)
         {
+            case Register_Address::Device_Loop_Timing:
+                return &Device_Loop_Timing;
+            case Register_Address::Device_Task_Timing:
+                return &Device_Task_Timing;
             case Register_Address::Device_Self_Test_Result:
                 return &Device_Self_Test_Result;
+            case Register_Address::Device_Benchmark_Result:
+                return &Device_Benchmark_Result;
             case Register_Address::Git_Hash:
                 return &Git_Hash;
+            case Register_Address::Display_Frame_Timing:
+                return &Display_Frame_Timing;
+            case Register_Address::Display_Power_Current:
+                return &Display_Power_Current;
+            case Register_Address::PFuse_Record_Info:
+                return &PFuse_Record_Info;
+            case Register_Address::PFuse_Record_Data:
+                return &PFuse_Record_Data;
             default:
                 return nullptr;
         }
@@ -224,6 +287,12 @@ struct RegisterMap
                 return &Device_Target_Voltage;
             case Register_Address::Device_Target_Current:
                 return &Device_Target_Current;
+            case Register_Address::Device_Reset_Reason:
+                return &Device_Reset_Reason;
+            case Register_Address::Device_Stalled_Task:
+                return &Device_Stalled_Task;
+            case Register_Address::Device_Benchmark:
+                return &Device_Benchmark;
             case Register_Address::Bus_Voltage:
                 return &Bus_Voltage;
             case Register_Address::Shunt_Voltage:
@@ -246,12 +315,28 @@ struct RegisterMap
                 return &Display_Background_Color;
             case Register_Address::Display_Text_Color:
                 return &Display_Text_Color;
+            case Register_Address::Display_Max_FPS:
+                return &Display_Max_FPS;
+            case Register_Address::Display_Render_Load:
+                return &Display_Render_Load;
+            case Register_Address::Display_Debug_Overlay:
+                return &Display_Debug_Overlay;
+            case Register_Address::Display_Dim_Timeout:
+                return &Display_Dim_Timeout;
+            case Register_Address::Display_Sleep_Timeout:
+                return &Display_Sleep_Timeout;
+            case Register_Address::Display_Dim_Brightness:
+                return &Display_Dim_Brightness;
+            case Register_Address::Display_Power_State:
+                return &Display_Power_State;
             case Register_Address::PFuse_Status:
                 return &PFuse_Status;
             case Register_Address::PFuse_Warning_Current:
                 return &PFuse_Warning_Current;
             case Register_Address::PFuse_Trip_Current:
                 return &PFuse_Trip_Current;
+            case Register_Address::PFuse_Record_Page:
+                return &PFuse_Record_Page;
             case Register_Address::USB_PD_Status:
                 return &USB_PD_Status;
             case Register_Address::USB_PD_IsPD:
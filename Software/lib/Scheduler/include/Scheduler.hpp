@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdio.h>
+#include <limits.h>
+#include "pico/stdlib.h"
+
+#define SCHEDULER_MAX_TASKS         8
+#define SCHEDULER_STATS_PERIOD      1000000     // 1s
+#define SCHEDULER_NO_TASK           0xff
+#define SCHEDULER_LOWEST_PRIORITY   0xff
+
+/**
+ * @brief The work of a task
+ * @param context whatever was passed along with the task
+*/
+typedef void (*Scheduler_Function)(void* context);
+
+/**
+ * @brief A scheduled task
+ * @param function the work of the task
+ * @param context passed along to the function
+ * @param period the time between two releases in microseconds
+ * @param priority the lower the more urgent, the most urgent task that is due runs first
+ * @param critical whether the task also runs from yield() inside less urgent tasks
+ * @param enabled whether the task is scheduled
+ * @param running whether the task is running right now, possibly interrupted by a yield
+ * @param deadline the time the task is due next, it should have started by then
+*/
+struct Scheduler_Task
+{
+    Scheduler_Function function;
+    void* context;
+    unsigned int period;
+    unsigned int priority;
+    bool critical;
+    bool enabled;
+    bool running;
+    unsigned int deadline;
+
+    // the statistics of the period that is being gathered
+    unsigned int runs;
+    unsigned int lateness;
+    unsigned int runtime;
+};
+
+/**
+ * @brief The statistics of a task over the last period
+ * @param runs the number of times the task ran
+ * @param overruns the number of releases the task missed since it was added, because it started a full period late
+ * @param lateness the most time between the deadline and the start of the task, in microseconds
+ * @param runtime the longest the task took, including whatever ran from its yields, in microseconds
+*/
+struct Scheduler_Stats
+{
+    unsigned int runs;
+    unsigned int overruns;
+    unsigned int lateness;
+    unsigned int runtime;
+};
+
+class Scheduler
+{
+public:
+    Scheduler();
+
+    void addTask(unsigned int task, Scheduler_Function function, void* context, unsigned int period,
+        unsigned int priority, bool critical = false);
+    void setPeriod(unsigned int task, unsigned int period);
+    void run();
+    void yield();
+    static void yieldHook(void* context);
+
+    Scheduler_Stats getStats(unsigned int task);
+private:
+    Scheduler_Task tasks[SCHEDULER_MAX_TASKS] = {};
+    unsigned int overruns[SCHEDULER_MAX_TASKS] = {0};
+    Scheduler_Stats results[SCHEDULER_MAX_TASKS] = {};
+    unsigned int current = SCHEDULER_NO_TASK;
+    unsigned int statsStart = 0;
+
+    unsigned int pick(unsigned int now, unsigned int priority, bool criticalOnly);
+    void execute(unsigned int task, unsigned int now);
+    void commit(unsigned int now);
+};
@@ -0,0 +1,196 @@
+#include "Scheduler.hpp"
+
+/**
+ * @brief Construct a new Scheduler:: Scheduler object
+*/
+Scheduler::Scheduler()
+{
+    this->statsStart = time_us_32();
+}
+
+/**
+ * @brief Add a task to the schedule, it is due right away
+ * @param task the identifier of the task, has to be below SCHEDULER_MAX_TASKS
+ * @param function the work of the task
+ * @param context passed along to the function
+ * @param period the time between two releases in microseconds, at least 1
+ * @param priority the lower the more urgent, tasks with the same priority run in the order of their identifiers
+ * @param critical whether the task also runs from yield() inside less urgent tasks. It must not touch
+ * anything those might be in the middle of.
+*/
+void Scheduler::addTask(unsigned int task, Scheduler_Function function, void* context, unsigned int period,
+    unsigned int priority, bool critical)
+{
+    if(task >= SCHEDULER_MAX_TASKS || function == nullptr)
+        return;
+
+    this->tasks[task] = {};
+    this->tasks[task].function = function;
+    this->tasks[task].context = context;
+    this->tasks[task].period = MAX(period, 1u);
+    this->tasks[task].priority = MIN(priority, SCHEDULER_LOWEST_PRIORITY - 1);
+    this->tasks[task].critical = critical;
+    this->tasks[task].deadline = time_us_32();
+    this->tasks[task].enabled = true;
+    this->overruns[task] = 0;
+}
+
+/**
+ * @brief Change the period of a task
+ * @param task the identifier of the task
+ * @param period the time between two releases in microseconds, at least 1
+ * @note Takes effect from the next release on
+*/
+void Scheduler::setPeriod(unsigned int task, unsigned int period)
+{
+    if(task >= SCHEDULER_MAX_TASKS)
+        return;
+    this->tasks[task].period = MAX(period, 1u);
+}
+
+/**
+ * @brief Run the most urgent task that is due, or sleep until the next one is
+ * @note Call this over and over from the main loop. The sleep is a wait for event with a timeout, so
+ * any interrupt cuts it short and the loop comes around again.
+*/
+void Scheduler::run()
+{
+    unsigned int now = time_us_32();
+    this->commit(now);
+
+    unsigned int task = this->pick(now, SCHEDULER_LOWEST_PRIORITY, false);
+    if(task != SCHEDULER_NO_TASK)
+    {
+        this->execute(task, now);
+        return;
+    }
+
+    // nothing is due, find out how long until something is
+    int wait = INT_MAX;
+    for(unsigned int i = 0; i < SCHEDULER_MAX_TASKS; i++)
+        if(this->tasks[i].enabled)
+            wait = MIN(wait, (int)(this->tasks[i].deadline - now));
+
+    if(wait > 0 && wait != INT_MAX)
+        best_effort_wfe_or_timeout(make_timeout_time_us(wait));
+}
+
+/**
+ * @brief Run the critical tasks that are due and more urgent than the task that is running
+ * @note Call this from points in long tasks where nothing a critical task touches is half done,
+ * so the critical tasks never have to wait for the whole of it.
+*/
+void Scheduler::yield()
+{
+    unsigned int priority = SCHEDULER_LOWEST_PRIORITY;
+    if(this->current != SCHEDULER_NO_TASK)
+        priority = this->tasks[this->current].priority;
+
+    unsigned int now = time_us_32();
+    unsigned int task;
+    while((task = this->pick(now, priority, true)) != SCHEDULER_NO_TASK)
+    {
+        this->execute(task, now);
+        now = time_us_32();
+    }
+}
+
+/**
+ * @brief Yield from a callback that only takes a context, like the yield hook of the widgets
+ * @param context the scheduler
+*/
+void Scheduler::yieldHook(void* context)
+{
+    ((Scheduler*)context)->yield();
+}
+
+/**
+ * @brief Get the statistics of a task over the last period
+ * @param task the identifier of the task
+ * @return the statistics, all zero if the task does not exist
+*/
+Scheduler_Stats Scheduler::getStats(unsigned int task)
+{
+    if(task >= SCHEDULER_MAX_TASKS)
+        return {};
+    return this->results[task];
+}
+
+/**
+ * @private
+ * @brief Find the most urgent task that is due
+ * @param now the current time
+ * @param priority only tasks more urgent than this are considered
+ * @param criticalOnly whether only the critical tasks are considered
+ * @return the identifier of the task, SCHEDULER_NO_TASK if none is due
+*/
+unsigned int Scheduler::pick(unsigned int now, unsigned int priority, bool criticalOnly)
+{
+    unsigned int best = SCHEDULER_NO_TASK;
+    for(unsigned int i = 0; i < SCHEDULER_MAX_TASKS; i++)
+    {
+        Scheduler_Task* task = &this->tasks[i];
+        if(!task->enabled || task->running || task->priority >= priority || (criticalOnly && !task->critical))
+            continue;
+        // the timer wraps, so the difference tells whether the deadline passed
+        if((int)(now - task->deadline) < 0)
+            continue;
+
+        best = i;
+        priority = task->priority;
+    }
+    return best;
+}
+
+/**
+ * @private
+ * @brief Run a task and work out its next deadline
+ * @param task the identifier of the task
+ * @param now the time the task was picked at
+*/
+void Scheduler::execute(unsigned int task, unsigned int now)
+{
+    Scheduler_Task* entry = &this->tasks[task];
+
+    // a task that is a full period late missed a release, those are skipped instead of run back to back
+    unsigned int late = now - entry->deadline;
+    if(late >= entry->period)
+    {
+        this->overruns[task] += late / entry->period;
+        entry->deadline = now + entry->period;
+    }
+    else
+        entry->deadline += entry->period;
+
+    unsigned int interrupted = this->current;
+    this->current = task;
+    entry->running = true;
+    unsigned int start = time_us_32();
+    entry->function(entry->context);
+    unsigned int runtime = time_us_32() - start;
+    entry->running = false;
+    this->current = interrupted;
+
+    entry->runs++;
+    entry->lateness = MAX(entry->lateness, late);
+    entry->runtime = MAX(entry->runtime, runtime);
+}
+
+/**
+ * @private
+ * @brief Publish the statistics once a period is complete
+ * @param now the current time
+*/
+void Scheduler::commit(unsigned int now)
+{
+    if((now - this->statsStart) < SCHEDULER_STATS_PERIOD)
+        return;
+
+    for(unsigned int i = 0; i < SCHEDULER_MAX_TASKS; i++)
+    {
+        Scheduler_Task* task = &this->tasks[i];
+        this->results[i] = { task->runs, this->overruns[i], task->lateness, task->runtime };
+        task->runs = task->lateness = task->runtime = 0;
+    }
+    this->statsStart = now;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Screen.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "hardware/structs/xip_ctrl.h"
+
+#define BACKGROUND_MAGIC        0x42474e44  // "BGND"
+#define BACKGROUND_HEADER_SIZE  FLASH_PAGE_SIZE
+
+class Profiler;
+
+/**
+ * @brief The header stored in front of the cached pixels
+ * @param magic BACKGROUND_MAGIC if the cache is valid
+ * @param width the width of the background in pixels
+ * @param height the height of the background in pixels
+ * @param checksum checksum of the pixels
+*/
+struct Background_Header
+{
+    unsigned int magic;
+    unsigned int width;
+    unsigned int height;
+    unsigned int checksum;
+};
+
+class Background
+{
+public:
+    Background(unsigned short* frameBuffer, unsigned int width, unsigned int height, unsigned int flashOffset);
+    void init();
+    void setProfiler(Profiler* profiler, unsigned int stage);
+
+    void save();
+    void restore(Screen_Rect rect);
+    void restoreAll();
+private:
+    unsigned short* frameBuffer;
+    unsigned int width;
+    unsigned int height;
+    unsigned int flashOffset;
+    unsigned int dmaChannel;
+    Profiler* profiler = nullptr;
+    unsigned int stage = 0;
+
+    const Background_Header* getHeader();
+    unsigned int checksum();
+    void copyArea(Screen_Rect rect);
+    void copy(unsigned short* destination, unsigned int source, unsigned int count);
+    void stream(unsigned short* destination, unsigned int source, unsigned int count);
+};
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "hardware/clocks.h"
+
+#define BACKLIGHT_FREQUENCY     20000   // 20kHz, above what can be heard from the inductor or seen on camera
+#define BACKLIGHT_MAX_LEVEL     100     // the level is in percent
+
+class Backlight
+{
+public:
+    Backlight(unsigned int pin);
+    void init();
+
+    void setLevel(unsigned int level);
+    unsigned int getLevel();
+private:
+    unsigned int pin;
+    unsigned int slice = 0;
+    unsigned int wrap = 0;
+    unsigned int level = 0;
+};
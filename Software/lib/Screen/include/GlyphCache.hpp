@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Screen.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "Placement.hpp"
+
+#ifndef GLYPH_CACHE_SIZE
+#define GLYPH_CACHE_SIZE        32768   // bytes of coverage for all the glyphs together
+#endif
+#define GLYPH_CACHE_MAX_GLYPHS  20
+#define GLYPH_CACHE_FONT_MAGIC  0x38544e46  // "FNT8"
+
+/**
+ * @brief A glyph in the cache
+ * @param character the character
+ * @param width the width of the glyph, which is also how far the cursor advances
+ * @param top the first row that is not empty
+ * @param rows the number of rows from the top that are not empty
+ * @param coverage the coverage of those rows, in the cache or in flash
+*/
+struct GlyphCache_Glyph
+{
+    char character;
+    unsigned char width;
+    unsigned char top;
+    unsigned char rows;
+    const unsigned char* coverage;
+};
+
+/**
+ * @brief The header of a font asset
+ * @param magic GLYPH_CACHE_FONT_MAGIC
+ * @param height the line height in pixels
+ * @param glyphCount the number of glyphs
+ * @note The header is followed by the glyphs and then the coverage of all the glyphs
+*/
+struct GlyphCache_FontHeader
+{
+    unsigned int magic;
+    unsigned short height;
+    unsigned short glyphCount;
+};
+
+/**
+ * @brief A glyph in a font asset
+ * @param character the character
+ * @param width the width of the glyph
+ * @param top the first row that is not empty
+ * @param rows the number of rows from the top that are not empty
+ * @param offset the offset of the coverage of the glyph, counted from the end of the glyphs
+*/
+struct GlyphCache_FontGlyph
+{
+    unsigned char character;
+    unsigned char width;
+    unsigned char top;
+    unsigned char rows;
+    unsigned int offset;
+};
+
+class GlyphCache
+{
+public:
+    GlyphCache(unsigned short* frameBuffer, unsigned int width, unsigned int height);
+
+    void setHeight(unsigned int height);
+    void setTarget(unsigned short* buffer, unsigned int top, unsigned int rows);
+    void resetTarget();
+    bool capture(char character, unsigned int x, unsigned int y, unsigned int width);
+    unsigned int load(const unsigned char* font, const char* characters = nullptr, bool copy = true);
+    unsigned int getHeight();
+    unsigned int measure(const char* text);
+    unsigned int draw(char character, unsigned int x, unsigned int y, unsigned short color);
+    unsigned int draw(const char* text, unsigned int x, unsigned int y, unsigned short color);
+private:
+    unsigned short* frameBuffer;
+    unsigned int width;
+    unsigned int height;
+
+    // glyphs are drawn into the target, which holds a band of rows of the frame
+    unsigned short* target;
+    unsigned int targetTop = 0;
+    unsigned int targetRows;
+
+    unsigned int glyphHeight = 0;
+    GlyphCache_Glyph glyphs[GLYPH_CACHE_MAX_GLYPHS];
+    unsigned int glyphCount = 0;
+    unsigned char coverage[GLYPH_CACHE_SIZE];
+    unsigned int used = 0;
+
+    const GlyphCache_Glyph* find(char character);
+    unsigned short blend(unsigned short background, unsigned short color, unsigned char alpha);
+};
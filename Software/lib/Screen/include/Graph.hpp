@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Screen.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+
+#define GRAPH_SERIES            3       // voltage, current and power
+#define GRAPH_MAX_COLUMNS       320     // one column per line of the display memory
+#define GRAPH_GRID_LINES        4       // horizontal divisions
+#define GRAPH_DEFAULT_INTERVAL  100000  // 100ms per column
+#define GRAPH_MIN_SCALE         1000    // smallest full scale, in micro units
+#define GRAPH_BACKGROUND        0x0000  // black in RGB565
+#define GRAPH_GRID              0x2104  // dark grey in RGB565
+
+/**
+ * @brief One column of the graph, the range each series covered while it was being collected
+ * @param min the lowest value of each series, in micro units
+ * @param max the highest value of each series, in micro units
+*/
+struct Graph_Column
+{
+    int min[GRAPH_SERIES];
+    int max[GRAPH_SERIES];
+};
+
+class Graph
+{
+public:
+    Graph(Screen* screen, unsigned short* frameBuffer, unsigned int width, unsigned int height, unsigned int left, bool mirrored);
+
+    void setColor(unsigned int series, unsigned short color);
+    void setInterval(unsigned int interval);
+    bool push(const int values[GRAPH_SERIES]);
+
+    void show();
+    void hide();
+    void redraw();
+    bool isVisible();
+    bool render();
+
+    int getScale(unsigned int series);
+private:
+    Screen* screen;
+    unsigned short* frameBuffer;
+    unsigned int width;
+    unsigned int height;
+    unsigned int left;
+    unsigned int columns;
+    bool mirrored;
+
+    // the ring index of a column is also where it sits in the frame buffer, so nothing ever moves
+    Graph_Column ring[GRAPH_MAX_COLUMNS];
+    unsigned int head = 0;
+    unsigned int count = 0;
+    unsigned int pending = 0;
+
+    // the column that is still being collected
+    Graph_Column next;
+    unsigned int samples = 0;
+    unsigned int interval = GRAPH_DEFAULT_INTERVAL;
+    unsigned int columnStart = 0;
+
+    int scales[GRAPH_SERIES];
+    unsigned short colors[GRAPH_SERIES] = { 0xffff, 0xffff, 0xffff };
+    bool visible = false;
+    bool rescaled = false;
+
+    bool updateScales();
+    int niceScale(int value);
+    void drawColumn(unsigned int index);
+    unsigned int toRow(int value, unsigned int series);
+    unsigned int scrollLine();
+};
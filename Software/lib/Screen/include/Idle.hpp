@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+
+#define IDLE_SETTLE_TIME        500000  // 500ms, the current is only measured once the new state settled
+#define IDLE_FILTER_SHIFT       4       // the average current follows a new sample by 1/16th
+
+/**
+ * @brief The states the display goes through when nobody is looking at it
+ * @param IDLE_ACTIVE full brightness, rendering as usual
+ * @param IDLE_DIMMED the backlight is dimmed, still rendering
+ * @param IDLE_SLEEPING the backlight and the panel are off, nothing is rendered
+*/
+typedef enum
+{
+    IDLE_ACTIVE,
+    IDLE_DIMMED,
+    IDLE_SLEEPING,
+    IDLE_STATES,
+} Idle_State;
+
+class Idle
+{
+public:
+    Idle(unsigned int dimTimeout, unsigned int sleepTimeout);
+
+    void setTimeouts(unsigned int dimTimeout, unsigned int sleepTimeout);
+    bool activity();
+    bool update();
+    Idle_State getState();
+
+    void measure(int current);
+    int getCurrent(Idle_State state);
+private:
+    unsigned int dimTimeout;
+    unsigned int sleepTimeout;
+    Idle_State state = IDLE_ACTIVE;
+    bool changed = false;
+    unsigned int lastActivity = 0;
+    unsigned int stateStart = 0;
+
+    int current[IDLE_STATES] = {0};
+    bool measured[IDLE_STATES] = {false};
+
+    void enter(Idle_State state);
+};
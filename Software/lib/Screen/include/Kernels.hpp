@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Screen.hpp"
+
+#include <stdio.h>
+#include <math.h>
+#include "pico/stdlib.h"
+#include "hardware/interp.h"
+#include "Placement.hpp"
+
+#define KERNELS_RAMP_SIZE       256     // colors between the two ends of a gradient
+#define KERNELS_RADIAL_BITS     10      // the squared distance table holds 1 << bits colors
+#define KERNELS_FRACTION_BITS   16      // fixed point coordinates are 16.16
+
+class Kernels
+{
+public:
+    Kernels(interp_hw_t* interp = interp1);
+
+    void setInterpolator(bool enabled);
+
+    static unsigned short lerp(unsigned short from, unsigned short to, unsigned int alpha);
+    void ramp(unsigned short* colors, unsigned int count, unsigned short from, unsigned short to);
+
+    void setLinear(int x, int y, unsigned int radius, int angle, unsigned short from, unsigned short to);
+    void linear(unsigned short* pixels, unsigned int stride, Screen_Rect area);
+    static void linearLayer(unsigned short* band, Screen_Rect area, void* context);
+
+    void setRadial(int x, int y, unsigned int radius, unsigned short from, unsigned short to);
+    void radial(unsigned short* pixels, unsigned int stride, Screen_Rect area);
+    static void radialLayer(unsigned short* band, Screen_Rect area, void* context);
+
+    void rotate(unsigned short* pixels, unsigned int stride, Screen_Rect area,
+        const unsigned short* texture, unsigned int bits, int x, int y, int angle);
+private:
+    interp_hw_t* interp;
+    bool interpolator = true;
+
+    // the linear gradient, the ramp index of the top left pixel of the screen and its steps in 16.16
+    unsigned short linearRamp[KERNELS_RAMP_SIZE];
+    int linearStart = 0;
+    int linearStepX = 0;
+    int linearStepY = 0;
+
+    // the radial gradient, colors by squared distance from the center
+    unsigned short radialTable[1 << KERNELS_RADIAL_BITS];
+    unsigned short radialOutside = 0;
+    int radialX = 0;
+    int radialY = 0;
+    unsigned int radialLimit = 0;
+    unsigned int radialShift = 1;
+
+    static unsigned int squareRoot(unsigned int value);
+    void linearRow(unsigned short* pixels, int t, unsigned int count);
+    void linearRowInterpolated(unsigned short* pixels, int t, unsigned int count);
+    void radialRow(unsigned short* pixels, unsigned int d2, int dd, unsigned int count);
+    void radialRowInterpolated(unsigned short* pixels, unsigned int d2, int dd, unsigned int count);
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+
+#define PACER_DEFAULT_MAX_FPS       30
+#define PACER_DEFAULT_MAX_INTERVAL  1000000     // 1s
+#define PACER_LOAD_PERIOD           1000000     // 1s
+
+class Pacer
+{
+public:
+    Pacer(unsigned int maxFPS = PACER_DEFAULT_MAX_FPS, unsigned int maxInterval = PACER_DEFAULT_MAX_INTERVAL);
+
+    void setMaxFPS(unsigned int maxFPS);
+    void setMaxInterval(unsigned int maxInterval);
+    void request();
+    void animate(bool animating);
+    bool isDue();
+
+    void beginFrame();
+    void endFrame();
+    unsigned int getLoad();
+private:
+    unsigned int minInterval;
+    unsigned int maxInterval;
+    bool requested = true;
+    bool animating = false;
+
+    unsigned int lastFrame = 0;
+    unsigned int frameStart = 0;
+    unsigned int busy = 0;
+    unsigned int loadTimer = 0;
+    unsigned int load = 0;
+};
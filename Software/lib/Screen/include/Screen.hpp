@@ -0,0 +1,175 @@
+#pragma once
+
+#include "Screen_Commands.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+
+#define SCREEN_MAX_DIRTY_RECTS      8
+#define SCREEN_MAX_JOBS             (2 * (SCREEN_MAX_DIRTY_RECTS + 1))  // two chunks in flight, each area split once at most
+#define SCREEN_FRAME_COUNTER_PERIOD 1000000     // 1s
+#define SCREEN_SLEEP_OUT_DELAY      5000        // 5ms before the panel takes commands after sleep out
+#define SCREEN_SLEEP_IN_DELAY       120000      // 120ms after sleep out before the panel may sleep again
+
+/**
+ * @brief A rectangle on the screen
+ * @param x the left edge in pixels
+ * @param y the top edge in pixels
+ * @param width the width in pixels
+ * @param height the height in pixels
+*/
+struct Screen_Rect
+{
+    unsigned int x;
+    unsigned int y;
+    unsigned int width;
+    unsigned int height;
+};
+
+/**
+ * @brief Power modes of the panel
+ * @param SCREEN_POWER_ON full color
+ * @param SCREEN_POWER_IDLE 8 colors, the panel draws less current
+ * @param SCREEN_POWER_SLEEP the panel is off, the display memory keeps what was on it
+*/
+typedef enum
+{
+    SCREEN_POWER_ON,
+    SCREEN_POWER_IDLE,
+    SCREEN_POWER_SLEEP,
+} Screen_Power;
+
+/**
+ * @brief Timing of the last frame, all in microseconds
+ * @param render the time from beginFrame() to submit()
+ * @param transfer the time the DMA spent streaming the last frame to the display
+ * @param overlap the part of the transfer that ran while the next frame was being rendered
+ * @param wait the time submit() had to wait for the previous transfer to finish
+ * @param pixels the number of pixels in the last transfer
+*/
+struct Screen_Timing
+{
+    unsigned int render;
+    unsigned int transfer;
+    unsigned int overlap;
+    unsigned int wait;
+    unsigned int pixels;
+};
+
+/**
+ * @brief The screen configuration
+ * @param spi the SPI instance the display is connected to, has to be initialized already
+ * @param dc the data/command pin
+ * @param cs the chip select pin
+ * @param width the width of the frame buffer in pixels
+ * @param height the height of the frame buffer in pixels
+ * @param offsetX the column offset of the visible area in the display memory
+ * @param offsetY the row offset of the visible area in the display memory
+ * @param pio the PIO instance to transmit with, or nullptr to use the SPI instance
+ * @param sck the clock pin, only used with PIO
+ * @param mosi the data pin, only used with PIO
+ * @param pioDivider the clock divider of the state machine, the display clock is half the state machine clock
+*/
+typedef struct
+{
+    spi_inst_t* spi;
+    unsigned int dc;
+    unsigned int cs;
+    unsigned int width;
+    unsigned int height;
+    unsigned int offsetX;
+    unsigned int offsetY;
+    PIO pio;
+    unsigned int sck;
+    unsigned int mosi;
+    float pioDivider;
+} screen_config_t;
+
+class Screen
+{
+public:
+    Screen(screen_config_t* config, unsigned short* frameBuffer);
+    void init();
+
+    void invalidate(unsigned int x, unsigned int y, unsigned int width, unsigned int height);
+    void invalidate(Screen_Rect rect);
+    void invalidateAll();
+    bool isDirty();
+
+    void update();
+    void setTransferBuffer(unsigned short* buffer, unsigned int size);
+    void beginFrame();
+    void submit();
+    void write(Screen_Rect rect, const unsigned short* pixels);
+    bool isBusy();
+    void wait();
+
+    void setScrollArea(unsigned int top, unsigned int lines, unsigned int bottom);
+    void scroll(unsigned int line);
+
+    void setPower(Screen_Power power);
+    Screen_Power getPower();
+
+    unsigned int getFrameCounter();
+    Screen_Timing getTiming();
+    unsigned int getClock();
+private:
+    screen_config_t* config;
+    unsigned short* frameBuffer;
+    unsigned int dmaChannel;
+    unsigned int sm = 0;
+
+    Screen_Rect dirtyRects[SCREEN_MAX_DIRTY_RECTS];
+    unsigned int dirtyCount = 0;
+
+    // the transfer buffer holds the changed areas packed back to back while the DMA streams them out.
+    // The jobs are a ring, the counts keep going up for the whole frame
+    unsigned short* transferBuffer = nullptr;
+    unsigned int transferSize = 0;
+    Screen_Rect jobs[SCREEN_MAX_JOBS];
+    const unsigned short* jobPixels[SCREEN_MAX_JOBS];
+    volatile unsigned int jobCount = 0;
+    volatile unsigned int jobIndex = 0;
+    volatile bool jobsOpen = false;     // more jobs of the frame are still to come
+    volatile bool busy = false;
+
+    unsigned int renderStart = 0;
+    unsigned int transferStart = 0;
+    volatile unsigned int transferEnd = 0;
+    Screen_Timing timing = {0};
+
+    // the scroll position is only sent once the pixels of the frame are out, so both show up together
+    unsigned int scrollLine = 0;
+    volatile bool scrollPending = false;
+    static Screen* instance;
+
+    Screen_Power power = SCREEN_POWER_ON;
+    unsigned int wakeTime = 0;
+
+    unsigned int frames = 0;
+    unsigned int frameCounter = 0;
+    unsigned int frameTimer = 0;
+
+    bool touches(Screen_Rect a, Screen_Rect b);
+    Screen_Rect merge(Screen_Rect a, Screen_Rect b);
+    void writeCommand(unsigned char command, const unsigned char* data, unsigned int length, unsigned int pixels = 0);
+    void sendCommand(unsigned char command);
+    void setWindow(Screen_Rect rect);
+    void writePixels(const unsigned short* pixels, unsigned int count);
+    void beginPixels();
+    void endPixels();
+    void waitForSPI();
+    void waitForPIO();
+    void writeScroll();
+    void countFrame();
+    void startJob(unsigned int job);
+    void queueJobs(unsigned int count, bool last);
+    static void irqHandler();
+};
\ No newline at end of file
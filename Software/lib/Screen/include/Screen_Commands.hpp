@@ -0,0 +1,14 @@
+#pragma once
+
+// ST7789 commands used by the screen, see the ST7789 datasheet for the full list
+#define ST7789_SLPIN    0x10    // sleep in
+#define ST7789_SLPOUT   0x11    // sleep out
+#define ST7789_DISPOFF  0x28    // display off
+#define ST7789_DISPON   0x29    // display on
+#define ST7789_CASET    0x2A    // column address set
+#define ST7789_RASET    0x2B    // row address set
+#define ST7789_RAMWR    0x2C    // memory write
+#define ST7789_VSCRDEF  0x33    // vertical scrolling definition
+#define ST7789_VSCRSADD 0x37    // vertical scroll start address
+#define ST7789_IDMOFF   0x38    // idle mode off
+#define ST7789_IDMON    0x39    // idle mode on, 8 colors
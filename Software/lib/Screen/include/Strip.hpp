@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Screen.hpp"
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+
+#define STRIP_MAX_LAYERS    4
+
+/**
+ * @brief Draws its part of the scene into a band
+ * @param band the pixels of the band, as wide as the screen
+ * @param area the area of the screen the band covers
+ * @param context whatever was passed along with the layer
+*/
+typedef void (*Strip_Layer)(unsigned short* band, Screen_Rect area, void* context);
+
+class Strip
+{
+public:
+    Strip(Screen* screen, unsigned short* buffer, unsigned int width, unsigned int height, unsigned int bandHeight);
+
+    bool addLayer(Strip_Layer layer, void* context = nullptr);
+    void render(unsigned int top, unsigned int rows);
+    void renderAll();
+
+    unsigned int getBufferSize();
+private:
+    Screen* screen;
+    unsigned short* buffer;
+    unsigned int width;
+    unsigned int height;
+    unsigned int bandHeight;
+
+    Strip_Layer layers[STRIP_MAX_LAYERS];
+    void* contexts[STRIP_MAX_LAYERS];
+    unsigned int layerCount = 0;
+};
@@ -0,0 +1,214 @@
+#include "Background.hpp"
+#include "Profiler.hpp"
+
+/**
+ * @brief Construct a new Background:: Background object
+ * @param frameBuffer the frame buffer the background is restored into
+ * @param width the width of the frame buffer in pixels
+ * @param height the height of the frame buffer in pixels
+ * @param flashOffset the offset of the flash area reserved for the cache, has to be sector aligned
+*/
+Background::Background(unsigned short* frameBuffer, unsigned int width, unsigned int height, unsigned int flashOffset)
+{
+    this->frameBuffer = frameBuffer;
+    this->width = width;
+    this->height = height;
+    this->flashOffset = flashOffset;
+}
+
+/**
+ * @brief Initialize the background
+*/
+void Background::init()
+{
+    this->dmaChannel = dma_claim_unused_channel(true);
+}
+
+/**
+ * @brief Charge the time spent restoring the background to a stage of its own
+ * @param profiler the profiler of the loop, nullptr to stop
+ * @param stage the stage, nested in whatever stage the caller is in
+*/
+void Background::setProfiler(Profiler* profiler, unsigned int stage)
+{
+    this->profiler = profiler;
+    this->stage = stage;
+}
+
+/**
+ * @brief Save the current contents of the frame buffer as the background
+ * @note The flash is only written when the background changed, so this is cheap to call on every boot
+*/
+void Background::save()
+{
+    const Background_Header* header = this->getHeader();
+    Background_Header newHeader = { BACKGROUND_MAGIC, this->width, this->height, this->checksum() };
+
+    // nothing to do if the flash already holds this exact background
+    if(header->magic == newHeader.magic && header->width == newHeader.width &&
+        header->height == newHeader.height && header->checksum == newHeader.checksum)
+        return;
+
+    unsigned int size = this->width * this->height * sizeof(unsigned short);
+    unsigned int total = BACKGROUND_HEADER_SIZE + size;
+    const unsigned char* pixels = (const unsigned char*)this->frameBuffer;
+
+    // erase and program one sector at a time, so the interrupts get a chance to run in between
+    for(unsigned int offset = 0; offset < total; offset += FLASH_SECTOR_SIZE)
+    {
+        unsigned int interrupts = save_and_disable_interrupts();
+        flash_range_erase(this->flashOffset + offset, FLASH_SECTOR_SIZE);
+        restore_interrupts(interrupts);
+    }
+
+    for(unsigned int offset = 0; offset < size; offset += FLASH_SECTOR_SIZE)
+    {
+        unsigned int length = MIN(FLASH_SECTOR_SIZE, size - offset);
+        unsigned char page[FLASH_PAGE_SIZE];
+
+        unsigned int interrupts = save_and_disable_interrupts();
+        // the flash can only be programmed in full pages, the last partial page goes through a copy
+        unsigned int fullPages = length & ~(FLASH_PAGE_SIZE - 1);
+        if(fullPages > 0)
+            flash_range_program(this->flashOffset + BACKGROUND_HEADER_SIZE + offset, pixels + offset, fullPages);
+        if(fullPages < length)
+        {
+            memset(page, 0xff, sizeof(page));
+            memcpy(page, pixels + offset + fullPages, length - fullPages);
+            flash_range_program(this->flashOffset + BACKGROUND_HEADER_SIZE + offset + fullPages, page, FLASH_PAGE_SIZE);
+        }
+        restore_interrupts(interrupts);
+    }
+
+    // the header goes last, so a reset halfway through leaves an invalid cache behind
+    unsigned char page[FLASH_PAGE_SIZE];
+    memset(page, 0xff, sizeof(page));
+    memcpy(page, &newHeader, sizeof(newHeader));
+    unsigned int interrupts = save_and_disable_interrupts();
+    flash_range_program(this->flashOffset, page, FLASH_PAGE_SIZE);
+    restore_interrupts(interrupts);
+}
+
+/**
+ * @brief Restore an area of the frame buffer from the cached background
+ * @param rect the area to restore
+*/
+void Background::restore(Screen_Rect rect)
+{
+    if(this->profiler == nullptr)
+    {
+        this->copyArea(rect);
+        return;
+    }
+
+    this->profiler->enter(this->stage);
+    this->copyArea(rect);
+    this->profiler->leave();
+}
+
+/**
+ * @brief Restore the entire frame buffer from the cached background
+*/
+void Background::restoreAll()
+{
+    this->restore({0, 0, this->width, this->height});
+}
+
+/**
+ * @private
+ * @brief Copy an area of the cached background into the frame buffer
+ * @param rect the area to restore
+*/
+void Background::copyArea(Screen_Rect rect)
+{
+    // clip the area to the frame buffer
+    if(rect.x >= this->width || rect.y >= this->height)
+        return;
+    rect.width = MIN(rect.width, this->width - rect.x);
+    rect.height = MIN(rect.height, this->height - rect.y);
+
+    unsigned int start = rect.y * this->width + rect.x;
+
+    // full width areas are one contiguous span, which the XIP stream can read the fastest
+    if(rect.width == this->width)
+    {
+        unsigned int count = rect.width * rect.height;
+        if((start & 1) == 0 && (count & 1) == 0)
+            this->stream(this->frameBuffer + start, start, count);
+        else
+            this->copy(this->frameBuffer + start, start, count);
+        return;
+    }
+
+    for(unsigned int row = 0; row < rect.height; row++)
+        this->copy(this->frameBuffer + start + row * this->width, start + row * this->width, rect.width);
+}
+
+/**
+ * @private
+ * @brief Get the header of the cache
+ * @return pointer to the header in flash
+*/
+const Background_Header* Background::getHeader()
+{
+    return (const Background_Header*)(XIP_BASE + this->flashOffset);
+}
+
+/**
+ * @private
+ * @brief Calculate the checksum of the frame buffer
+ * @return the checksum
+*/
+unsigned int Background::checksum()
+{
+    unsigned int sum = 0;
+    for(unsigned int i = 0; i < this->width * this->height; i++)
+        sum = ((sum << 1) | (sum >> 31)) ^ this->frameBuffer[i];
+    return sum;
+}
+
+/**
+ * @private
+ * @brief Copy pixels from the cache through the uncached flash alias
+ * @param destination where to copy the pixels to
+ * @param source the index of the first pixel in the cache
+ * @param count the number of pixels
+ * @note The uncached alias keeps the background from evicting the code from the XIP cache
+*/
+void Background::copy(unsigned short* destination, unsigned int source, unsigned int count)
+{
+    const unsigned short* pixels = (const unsigned short*)(XIP_NOCACHE_NOALLOC_BASE + this->flashOffset + BACKGROUND_HEADER_SIZE);
+
+    dma_channel_config dmaConfig = dma_channel_get_default_config(this->dmaChannel);
+    channel_config_set_transfer_data_size(&dmaConfig, DMA_SIZE_16);
+    channel_config_set_read_increment(&dmaConfig, true);
+    channel_config_set_write_increment(&dmaConfig, true);
+    dma_channel_configure(this->dmaChannel, &dmaConfig, destination, pixels + source, count, true);
+    dma_channel_wait_for_finish_blocking(this->dmaChannel);
+}
+
+/**
+ * @private
+ * @brief Copy pixels from the cache through the XIP stream FIFO
+ * @param destination where to copy the pixels to, has to be word aligned
+ * @param source the index of the first pixel in the cache, has to be even
+ * @param count the number of pixels, has to be even
+*/
+void Background::stream(unsigned short* destination, unsigned int source, unsigned int count)
+{
+    // stop whatever stream might still be running and empty the FIFO
+    xip_ctrl_hw->stream_ctr = 0;
+    while(!(xip_ctrl_hw->stat & XIP_STAT_FIFO_EMPTY))
+        (void)xip_ctrl_hw->stream_fifo;
+
+    xip_ctrl_hw->stream_addr = XIP_BASE + this->flashOffset + BACKGROUND_HEADER_SIZE + source * sizeof(unsigned short);
+    xip_ctrl_hw->stream_ctr = count / 2;
+
+    dma_channel_config dmaConfig = dma_channel_get_default_config(this->dmaChannel);
+    channel_config_set_transfer_data_size(&dmaConfig, DMA_SIZE_32);
+    channel_config_set_read_increment(&dmaConfig, false);
+    channel_config_set_write_increment(&dmaConfig, true);
+    channel_config_set_dreq(&dmaConfig, DREQ_XIP_STREAM);
+    dma_channel_configure(this->dmaChannel, &dmaConfig, destination, (const void*)XIP_AUX_BASE, count / 2, true);
+    dma_channel_wait_for_finish_blocking(this->dmaChannel);
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include "Backlight.hpp"
+
+/**
+ * @brief Construct a new Backlight:: Backlight object
+ * @param pin the pin the backlight is connected to
+*/
+Backlight::Backlight(unsigned int pin)
+{
+    this->pin = pin;
+}
+
+/**
+ * @brief Take the backlight pin over and drive it with PWM, the backlight starts off
+ * @note Call this after the display is initialized, in case the display driver set the pin up as well
+*/
+void Backlight::init()
+{
+    this->slice = pwm_gpio_to_slice_num(this->pin);
+
+    // count at the system clock and wrap at the frequency we are after
+    this->wrap = clock_get_hz(clk_sys) / BACKLIGHT_FREQUENCY - 1;
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_wrap(&config, this->wrap);
+    pwm_init(this->slice, &config, false);
+
+    pwm_set_gpio_level(this->pin, 0);
+    gpio_set_function(this->pin, GPIO_FUNC_PWM);
+    pwm_set_enabled(this->slice, true);
+    this->level = 0;
+}
+
+/**
+ * @brief Set the brightness of the backlight
+ * @param level the brightness in percent, clamped to 100
+ * @note The duty cycle goes up with the square of the level, which looks a lot more even than a straight line
+*/
+void Backlight::setLevel(unsigned int level)
+{
+    level = MIN(level, BACKLIGHT_MAX_LEVEL);
+    if(level == this->level)
+        return;
+
+    unsigned int duty = (this->wrap + 1) * level * level / (BACKLIGHT_MAX_LEVEL * BACKLIGHT_MAX_LEVEL);
+    pwm_set_gpio_level(this->pin, duty);
+    this->level = level;
+}
+
+/**
+ * @brief Get the brightness of the backlight
+ * @return the brightness in percent
+*/
+unsigned int Backlight::getLevel()
+{
+    return this->level;
+}
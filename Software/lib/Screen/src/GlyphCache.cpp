@@ -0,0 +1,265 @@
+#include "GlyphCache.hpp"
+
+/**
+ * @brief Construct a new GlyphCache:: GlyphCache object
+ * @param frameBuffer the frame buffer the glyphs are captured from and drawn into
+ * @param width the width of the frame buffer in pixels
+ * @param height the height of the frame buffer in pixels
+*/
+GlyphCache::GlyphCache(unsigned short* frameBuffer, unsigned int width, unsigned int height)
+{
+    this->frameBuffer = frameBuffer;
+    this->width = width;
+    this->height = height;
+    this->resetTarget();
+}
+
+/**
+ * @brief Set the height of the glyphs
+ * @param height the line height of the font in pixels
+ * @note Has to be set before capturing any glyphs
+*/
+void GlyphCache::setHeight(unsigned int height)
+{
+    this->glyphHeight = height;
+}
+
+/**
+ * @brief Draw into a band of the frame instead of the frame buffer
+ * @param buffer the band, as wide as the frame buffer
+ * @param top the row of the frame the band starts at
+ * @param rows the height of the band
+ * @note The glyphs are still positioned in frame coordinates, whatever falls outside of the band is cut off
+*/
+void GlyphCache::setTarget(unsigned short* buffer, unsigned int top, unsigned int rows)
+{
+    this->target = buffer;
+    this->targetTop = top;
+    this->targetRows = rows;
+}
+
+/**
+ * @brief Draw into the frame buffer again
+*/
+void GlyphCache::resetTarget()
+{
+    this->setTarget(this->frameBuffer, 0, this->height);
+}
+
+/**
+ * @brief Capture a glyph from the frame buffer
+ * @param character the character the glyph belongs to
+ * @param x the left edge of the glyph in the frame buffer
+ * @param y the top edge of the glyph in the frame buffer
+ * @param width the width of the glyph, as far as the cursor advanced
+ * @return true if the glyph was added to the cache
+ * @note The glyph has to be printed in white on black, the green channel is taken as its coverage.
+ * Empty rows above and below the glyph are not stored.
+*/
+bool GlyphCache::capture(char character, unsigned int x, unsigned int y, unsigned int width)
+{
+    if(this->glyphCount >= GLYPH_CACHE_MAX_GLYPHS || width > 0xff || this->glyphHeight > 0xff)
+        return false;
+    if(x + width > this->width || y + this->glyphHeight > this->height)
+        return false;
+
+    // find the rows that actually hold something
+    unsigned int top = this->glyphHeight;
+    unsigned int bottom = 0;
+    for(unsigned int row = 0; row < this->glyphHeight; row++)
+    {
+        const unsigned short* pixels = &this->frameBuffer[(y + row) * this->width + x];
+        for(unsigned int column = 0; column < width; column++)
+        {
+            if(pixels[column] == 0)
+                continue;
+            top = MIN(top, row);
+            bottom = row + 1;
+            break;
+        }
+    }
+    top = MIN(top, bottom);
+
+    unsigned int size = width * (bottom - top);
+    if(this->used + size > GLYPH_CACHE_SIZE)
+        return false;
+
+    unsigned char* coverage = &this->coverage[this->used];
+    for(unsigned int row = top; row < bottom; row++)
+    {
+        const unsigned short* pixels = &this->frameBuffer[(y + row) * this->width + x];
+        for(unsigned int column = 0; column < width; column++)
+        {
+            // stretch the 6 bit green channel to the full 8 bits
+            unsigned char green = (pixels[column] >> 5) & 0x3f;
+            coverage[(row - top) * width + column] = (green << 2) | (green >> 4);
+        }
+    }
+
+    this->glyphs[this->glyphCount++] = { character, (unsigned char)width, (unsigned char)top,
+        (unsigned char)(bottom - top), coverage };
+    this->used += size;
+    return true;
+}
+
+/**
+ * @brief Load glyphs from a font asset
+ * @param font the font asset, as converted by the asset pipeline
+ * @param characters the characters to load, or nullptr for all of them
+ * @param copy copy the coverage into the cache, otherwise it is drawn straight from flash
+ * @return the number of glyphs loaded
+ * @note Copying keeps drawing away from XIP. Drawing from flash costs no RAM at all, and works
+ * well with subset fonts, which keep the glyphs small and packed in the order they are used.
+*/
+unsigned int GlyphCache::load(const unsigned char* font, const char* characters, bool copy)
+{
+    const GlyphCache_FontHeader* header = (const GlyphCache_FontHeader*)font;
+    if(header->magic != GLYPH_CACHE_FONT_MAGIC)
+        return 0;
+
+    const GlyphCache_FontGlyph* glyphs = (const GlyphCache_FontGlyph*)(header + 1);
+    const unsigned char* coverage = (const unsigned char*)(glyphs + header->glyphCount);
+    this->glyphHeight = header->height;
+
+    unsigned int loaded = 0;
+    for(unsigned int i = 0; i < header->glyphCount; i++)
+    {
+        const GlyphCache_FontGlyph* glyph = &glyphs[i];
+        if(characters != nullptr && strchr(characters, glyph->character) == nullptr)
+            continue;
+
+        unsigned int size = glyph->width * glyph->rows;
+        if(this->glyphCount >= GLYPH_CACHE_MAX_GLYPHS || (copy && this->used + size > GLYPH_CACHE_SIZE))
+            break;
+
+        const unsigned char* source = coverage + glyph->offset;
+        if(copy)
+        {
+            memcpy(&this->coverage[this->used], source, size);
+            source = &this->coverage[this->used];
+            this->used += size;
+        }
+
+        this->glyphs[this->glyphCount++] = { (char)glyph->character, glyph->width, glyph->top, glyph->rows, source };
+        loaded++;
+    }
+
+    return loaded;
+}
+
+/**
+ * @brief Get the height of the glyphs
+ * @return the line height in pixels
+*/
+unsigned int GlyphCache::getHeight()
+{
+    return this->glyphHeight;
+}
+
+/**
+ * @brief Get the width of a string
+ * @param text the string, characters that are not in the cache are skipped
+ * @return the width in pixels
+*/
+unsigned int GlyphCache::measure(const char* text)
+{
+    unsigned int width = 0;
+    for(; *text; text++)
+    {
+        const GlyphCache_Glyph* glyph = this->find(*text);
+        if(glyph != nullptr)
+            width += glyph->width;
+    }
+    return width;
+}
+
+/**
+ * @brief Draw a glyph on top of whatever is in the frame buffer
+ * @param character the character to draw
+ * @param x the left edge in pixels
+ * @param y the top edge in pixels
+ * @param color the color in RGB565
+ * @return the width of the glyph, 0 if it is not in the cache
+*/
+unsigned int HOT_FUNC(GlyphCache::draw)(char character, unsigned int x, unsigned int y, unsigned short color)
+{
+    const GlyphCache_Glyph* glyph = this->find(character);
+    if(glyph == nullptr)
+        return 0;
+    if(x >= this->width)
+        return glyph->width;
+
+    // only the rows that hold something are stored, and only the ones inside the target are drawn
+    unsigned int first = y + glyph->top;
+    unsigned int start = MAX(first, this->targetTop);
+    unsigned int end = MIN(first + glyph->rows, this->targetTop + this->targetRows);
+    unsigned int columns = MIN(glyph->width, this->width - x);
+
+    for(unsigned int row = start; row < end; row++)
+    {
+        const unsigned char* coverage = &glyph->coverage[(row - first) * glyph->width];
+        unsigned short* pixels = &this->target[(row - this->targetTop) * this->width + x];
+
+        // most of the glyph is either empty or solid, only the edges need blending
+        for(unsigned int column = 0; column < columns; column++)
+        {
+            unsigned char alpha = coverage[column];
+            if(alpha == 0)
+                continue;
+            else if(alpha == 0xff)
+                pixels[column] = color;
+            else
+                pixels[column] = this->blend(pixels[column], color, alpha);
+        }
+    }
+
+    return glyph->width;
+}
+
+/**
+ * @brief Draw a string on top of whatever is in the frame buffer
+ * @param text the string, characters that are not in the cache are skipped
+ * @param x the left edge in pixels
+ * @param y the top edge in pixels
+ * @param color the color in RGB565
+ * @return the width of the string in pixels
+*/
+unsigned int HOT_FUNC(GlyphCache::draw)(const char* text, unsigned int x, unsigned int y, unsigned short color)
+{
+    unsigned int start = x;
+    for(; *text; text++)
+        x += this->draw(*text, x, y, color);
+    return x - start;
+}
+
+/**
+ * @private
+ * @brief Find a glyph in the cache
+ * @param character the character to look for
+ * @return the glyph, or nullptr if it is not in the cache
+*/
+const GlyphCache_Glyph* HOT_FUNC(GlyphCache::find)(char character)
+{
+    for(unsigned int i = 0; i < this->glyphCount; i++)
+        if(this->glyphs[i].character == character)
+            return &this->glyphs[i];
+    return nullptr;
+}
+
+/**
+ * @private
+ * @brief Blend a color on top of a background color
+ * @param background the background in RGB565
+ * @param color the color in RGB565
+ * @param alpha the coverage of the color, 0 to 255
+ * @return the blended color in RGB565
+*/
+unsigned short HOT_FUNC(GlyphCache::blend)(unsigned short background, unsigned short color, unsigned char alpha)
+{
+    // spread the channels out so all three can be blended with a single multiply
+    unsigned int a = alpha >> 3;
+    unsigned int bg = (background | (background << 16)) & 0x07e0f81f;
+    unsigned int fg = (color | (color << 16)) & 0x07e0f81f;
+    unsigned int result = ((((fg - bg) * a) >> 5) + bg) & 0x07e0f81f;
+    return (unsigned short)(result | (result >> 16));
+}
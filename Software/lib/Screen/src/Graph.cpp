@@ -0,0 +1,298 @@
+#include "Graph.hpp"
+
+/**
+ * @brief Construct a new Graph:: Graph object
+ * @param screen the screen the graph is pushed to, its scrolling is taken over while the graph is shown
+ * @param frameBuffer the frame buffer the graph is drawn into
+ * @param width the width of the frame buffer in pixels
+ * @param height the height of the frame buffer in pixels
+ * @param left the width of the fixed area on the left, for the labels
+ * @param mirrored whether the display memory lines run right to left, this depends on the rotation
+ * @note The graph scrolls along the lines of the display memory, so the frame buffer has to be
+ * in landscape, with one column per line
+*/
+Graph::Graph(Screen* screen, unsigned short* frameBuffer, unsigned int width, unsigned int height, unsigned int left, bool mirrored)
+{
+    this->screen = screen;
+    this->frameBuffer = frameBuffer;
+    this->width = width;
+    this->height = height;
+    this->left = left;
+    this->columns = MIN(width - left, GRAPH_MAX_COLUMNS);
+    this->mirrored = mirrored;
+
+    // the first column goes into the leftmost spot
+    this->head = this->columns - 1;
+    for(unsigned int i = 0; i < GRAPH_SERIES; i++)
+        this->scales[i] = GRAPH_MIN_SCALE;
+}
+
+/**
+ * @brief Set the color of a series
+ * @param series the index of the series
+ * @param color the color in RGB565
+*/
+void Graph::setColor(unsigned int series, unsigned short color)
+{
+    if(series < GRAPH_SERIES)
+        this->colors[series] = color;
+}
+
+/**
+ * @brief Set the time each column covers
+ * @param interval the time in microseconds
+ * @note Every sample pushed within the interval ends up in the same column as a min/max pair
+*/
+void Graph::setInterval(unsigned int interval)
+{
+    this->interval = interval;
+}
+
+/**
+ * @brief Add a sample to the graph
+ * @param values the value of each series, in micro units
+ * @return true if a column was completed and the graph has something new to show
+*/
+bool Graph::push(const int values[GRAPH_SERIES])
+{
+    if(this->samples == 0)
+    {
+        this->columnStart = time_us_32();
+        for(unsigned int i = 0; i < GRAPH_SERIES; i++)
+            this->next.min[i] = this->next.max[i] = values[i];
+    }
+    else
+    {
+        for(unsigned int i = 0; i < GRAPH_SERIES; i++)
+        {
+            this->next.min[i] = MIN(this->next.min[i], values[i]);
+            this->next.max[i] = MAX(this->next.max[i], values[i]);
+        }
+    }
+    this->samples++;
+
+    if((time_us_32() - this->columnStart) < this->interval)
+        return false;
+
+    // the column is done, it replaces the oldest one
+    this->head = (this->head + 1) % this->columns;
+    this->ring[this->head] = this->next;
+    this->count = MIN(this->count + 1, this->columns);
+    this->pending = MIN(this->pending + 1, this->columns);
+    this->samples = 0;
+
+    if(this->updateScales())
+        this->rescaled = true;
+    return true;
+}
+
+/**
+ * @brief Take over the screen and draw the entire graph
+ * @note The fixed area on the left is left alone, it belongs to whoever draws the labels
+*/
+void Graph::show()
+{
+    // the lines of the fixed area are at the end of the display memory if it runs the other way
+    if(this->mirrored)
+        this->screen->setScrollArea(0, this->columns, this->width - this->columns);
+    else
+        this->screen->setScrollArea(this->width - this->columns, this->columns, 0);
+
+    this->visible = true;
+    this->rescaled = true;
+}
+
+/**
+ * @brief Give the screen back and stop scrolling
+ * @note The frame buffer still holds the graph, the caller has to redraw the screen
+*/
+void Graph::hide()
+{
+    this->screen->setScrollArea(0, this->width, 0);
+    this->screen->scroll(0);
+    this->visible = false;
+}
+
+/**
+ * @brief Draw every column again with the next render, after something else drew over the graph
+*/
+void Graph::redraw()
+{
+    this->rescaled = true;
+}
+
+/**
+ * @brief Check if the graph is shown
+ * @return true if the graph is on the screen
+*/
+bool Graph::isVisible()
+{
+    return this->visible;
+}
+
+/**
+ * @brief Draw the columns that were added since the last call and scroll them into view
+ * @return true if the scale changed, the labels have to be redrawn
+ * @note Only the new columns are drawn and pushed, the rest of the graph is moved by the display
+ * itself. The entire graph is only redrawn when the scale changes.
+*/
+bool Graph::render()
+{
+    if(!this->visible)
+        return false;
+
+    bool rescaled = this->rescaled;
+    if(rescaled)
+    {
+        for(unsigned int i = 0; i < this->columns; i++)
+            this->drawColumn(i);
+        this->screen->invalidate(this->left, 0, this->columns, this->height);
+    }
+    else
+    {
+        for(unsigned int i = 0; i < this->pending; i++)
+        {
+            unsigned int index = (this->head + this->columns - i) % this->columns;
+            this->drawColumn(index);
+            this->screen->invalidate(this->left + index, 0, 1, this->height);
+        }
+    }
+
+    if(rescaled || this->pending > 0)
+        this->screen->scroll(this->scrollLine());
+
+    this->rescaled = false;
+    this->pending = 0;
+    return rescaled;
+}
+
+/**
+ * @brief Get the full scale of a series
+ * @param series the index of the series
+ * @return the value at the top of the graph, in micro units
+*/
+int Graph::getScale(unsigned int series)
+{
+    if(series >= GRAPH_SERIES)
+        return 0;
+    return this->scales[series];
+}
+
+/**
+ * @private
+ * @brief Fit the scale of each series to the columns in the ring
+ * @return true if any scale changed
+ * @note The scale grows as soon as a value does not fit, and shrinks once the peak has scrolled off
+*/
+bool Graph::updateScales()
+{
+    bool changed = false;
+    for(unsigned int series = 0; series < GRAPH_SERIES; series++)
+    {
+        int peak = 0;
+        for(unsigned int i = 0; i < this->count; i++)
+            peak = MAX(peak, this->ring[(this->head + this->columns - i) % this->columns].max[series]);
+
+        int scale = this->niceScale(peak);
+        if(scale != this->scales[series])
+        {
+            this->scales[series] = scale;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+/**
+ * @private
+ * @brief Round a value up to the next step of 1, 2, 5, 10, 20, 50...
+ * @param value the value in micro units
+ * @return the scale in micro units, at least GRAPH_MIN_SCALE
+*/
+int Graph::niceScale(int value)
+{
+    static const unsigned char steps[3] = { 2, 5, 10 };
+
+    int decade = GRAPH_MIN_SCALE;
+    int scale = GRAPH_MIN_SCALE;
+    for(unsigned int i = 0; scale < value; i = (i + 1) % 3)
+    {
+        // stop before the next step overflows
+        if(decade > INT32_MAX / steps[i])
+            break;
+
+        scale = decade * steps[i];
+        if(i == 2)
+            decade = scale;
+    }
+    return scale;
+}
+
+/**
+ * @private
+ * @brief Draw a column of the graph into the frame buffer
+ * @param index the index of the column in the ring, which is also its position in the graph
+*/
+void Graph::drawColumn(unsigned int index)
+{
+    unsigned int x = this->left + index;
+    unsigned short* pixels = &this->frameBuffer[x];
+
+    for(unsigned int row = 0; row < this->height; row++)
+        pixels[row * this->width] = GRAPH_BACKGROUND;
+    for(unsigned int line = 1; line < GRAPH_GRID_LINES; line++)
+        pixels[(this->height - 1) * line / GRAPH_GRID_LINES * this->width] = GRAPH_GRID;
+
+    // columns that were never filled stay empty
+    unsigned int age = (this->head + this->columns - index) % this->columns;
+    if(age >= this->count)
+        return;
+
+    const Graph_Column* column = &this->ring[index];
+    const Graph_Column* previous = &this->ring[(index + this->columns - 1) % this->columns];
+    bool connected = age + 1 < this->count;
+
+    // the first series ends up on top
+    for(int series = GRAPH_SERIES - 1; series >= 0; series--)
+    {
+        unsigned int top = this->toRow(column->max[series], series);
+        unsigned int bottom = this->toRow(column->min[series], series);
+
+        // stretch the column to reach the previous one, so steep edges do not leave gaps
+        if(connected)
+        {
+            top = MIN(top, this->toRow(previous->min[series], series));
+            bottom = MAX(bottom, this->toRow(previous->max[series], series));
+        }
+
+        for(unsigned int row = top; row <= bottom; row++)
+            pixels[row * this->width] = this->colors[series];
+    }
+}
+
+/**
+ * @private
+ * @brief Get the row a value is drawn at
+ * @param value the value in micro units
+ * @param series the index of the series, for its scale
+ * @return the row in the frame buffer
+*/
+unsigned int Graph::toRow(int value, unsigned int series)
+{
+    int scale = this->scales[series];
+    value = MAX(0, MIN(value, scale));
+    return (this->height - 1) - (unsigned int)((long long)value * (this->height - 1) / scale);
+}
+
+/**
+ * @private
+ * @brief Get the line of the display memory that has to be shown first, so the oldest column is on the left
+ * @return the scroll start address
+*/
+unsigned int Graph::scrollLine()
+{
+    unsigned int oldest = (this->head + 1) % this->columns;
+    if(this->mirrored)
+        return (this->columns - oldest) % this->columns;
+    return this->left + oldest;
+}
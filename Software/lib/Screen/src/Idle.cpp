@@ -0,0 +1,109 @@
+#include "Idle.hpp"
+
+/**
+ * @brief Construct a new Idle:: Idle object
+ * @param dimTimeout the time without activity before the backlight is dimmed in microseconds, 0 keeps the display on
+ * @param sleepTimeout the time after dimming before the display goes to sleep in microseconds, 0 stays dimmed
+*/
+Idle::Idle(unsigned int dimTimeout, unsigned int sleepTimeout)
+{
+    this->setTimeouts(dimTimeout, sleepTimeout);
+}
+
+/**
+ * @brief Set the timeouts
+ * @param dimTimeout the time without activity before the backlight is dimmed in microseconds, 0 keeps the display on
+ * @param sleepTimeout the time after dimming before the display goes to sleep in microseconds, 0 stays dimmed
+*/
+void Idle::setTimeouts(unsigned int dimTimeout, unsigned int sleepTimeout)
+{
+    this->dimTimeout = dimTimeout;
+    this->sleepTimeout = sleepTimeout;
+}
+
+/**
+ * @brief Something happened that someone wants to see, start counting from the beginning
+ * @return true if the display was dimmed or asleep, so the activity woke it up
+ * @note The state changes right away, update() only reports it
+*/
+bool Idle::activity()
+{
+    this->lastActivity = time_us_32();
+    if(this->state == IDLE_ACTIVE)
+        return false;
+
+    this->enter(IDLE_ACTIVE);
+    return true;
+}
+
+/**
+ * @brief Move on to the next state once its timeout ran out
+ * @return true if the state changed since the last call, including changes made by activity()
+ * @note Has to be called every loop
+*/
+bool Idle::update()
+{
+    unsigned int idle = time_us_32() - this->lastActivity;
+
+    // a timeout of 0 turns that state off, the sleep timeout starts counting once the display is dimmed
+    if(this->state == IDLE_ACTIVE && this->dimTimeout > 0 && idle >= this->dimTimeout)
+        this->enter(IDLE_DIMMED);
+    if(this->state == IDLE_DIMMED && this->sleepTimeout > 0 && idle >= this->dimTimeout + this->sleepTimeout)
+        this->enter(IDLE_SLEEPING);
+
+    bool changed = this->changed;
+    this->changed = false;
+    return changed;
+}
+
+/**
+ * @brief Get the current state
+ * @return the state
+*/
+Idle_State Idle::getState()
+{
+    return this->state;
+}
+
+/**
+ * @brief Add a sample of the current draw to the average of the current state
+ * @param current the current in any unit, the average is in the same unit
+ * @note The samples right after a change of state are skipped, until the backlight and the panel settled
+*/
+void Idle::measure(int current)
+{
+    if((time_us_32() - this->stateStart) < IDLE_SETTLE_TIME)
+        return;
+
+    // the first sample starts the average, after that it is a running average
+    int& average = this->current[this->state];
+    if(!this->measured[this->state])
+        average = current;
+    else
+        average += (current - average) >> IDLE_FILTER_SHIFT;
+    this->measured[this->state] = true;
+}
+
+/**
+ * @brief Get the average current drawn in a state
+ * @param state the state
+ * @return the average current in the unit it was measured in, 0 if the state was never measured
+*/
+int Idle::getCurrent(Idle_State state)
+{
+    if(state >= IDLE_STATES)
+        return 0;
+    return this->current[state];
+}
+
+/**
+ * @private
+ * @brief Switch to another state
+ * @param state the new state
+*/
+void Idle::enter(Idle_State state)
+{
+    this->state = state;
+    this->stateStart = time_us_32();
+    this->changed = true;
+}
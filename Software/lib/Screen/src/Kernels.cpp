@@ -0,0 +1,531 @@
+#include "Kernels.hpp"
+
+/**
+ * @brief Construct a new Kernels:: Kernels object
+ * @param interp the interpolator the gradients and the rotation run on, interp0 or interp1
+ * @note Both cores have their own pair of interpolators at the same address, so the kernels use the
+ * ones of whichever core calls them. The tables live in the object, so give each core its own.
+*/
+Kernels::Kernels(interp_hw_t* interp)
+{
+    this->interp = interp;
+}
+
+/**
+ * @brief Pick how the kernels run
+ * @param enabled true to run them through the interpolators, false for plain loops
+ * @note Only there to compare the two, the interpolators are the faster ones
+*/
+void Kernels::setInterpolator(bool enabled)
+{
+    this->interpolator = enabled;
+}
+
+/**
+ * @brief Mix two colors
+ * @param from the color at an alpha of 0, in RGB565
+ * @param to the color at an alpha of 256, in RGB565
+ * @param alpha how far along, from 0 to 256
+ * @return the mixed color in RGB565
+*/
+unsigned short Kernels::lerp(unsigned short from, unsigned short to, unsigned int alpha)
+{
+    int red = from >> 11;
+    int green = (from >> 5) & 0x3f;
+    int blue = from & 0x1f;
+
+    red += (((int)(to >> 11) - red) * (int)alpha) >> 8;
+    green += (((int)((to >> 5) & 0x3f) - green) * (int)alpha) >> 8;
+    blue += (((int)(to & 0x1f) - blue) * (int)alpha) >> 8;
+
+    return (red << 11) | (green << 5) | blue;
+}
+
+/**
+ * @brief Fill a table with the colors from one color to another
+ * @param colors where the colors go
+ * @param count the number of colors, the first one is from and the last one is to
+ * @param from the first color in RGB565
+ * @param to the last color in RGB565
+ * @note The interpolator version runs on interp0, the only one with a blend mode. It mixes one
+ * channel of every color before moving on to the next, so the bases are only written three times.
+*/
+void Kernels::ramp(unsigned short* colors, unsigned int count, unsigned short from, unsigned short to)
+{
+    if(count == 0)
+        return;
+
+    // the last color is set on its own, the blend mode can not reach an alpha of 256
+    colors[count - 1] = to;
+    if(count == 1)
+        return;
+    count--;
+
+    // the alpha in 16.16, stepping from 0 to just below 256 over the colors
+    unsigned int step = (256 << KERNELS_FRACTION_BITS) / count;
+
+    if(!this->interpolator)
+    {
+        unsigned int alpha = 0;
+        for(unsigned int i = 0; i < count; i++, alpha += step)
+            colors[i] = this->lerp(from, to, alpha >> KERNELS_FRACTION_BITS);
+        return;
+    }
+
+    // the interpolator belongs to whatever else runs on this core, so it is handed back the way it was
+    interp_hw_save_t saved;
+    interp_save(interp0, &saved);
+
+    // lane 1 picks the alpha out of its accumulator, lane 0 turns its peek into the mix of the bases
+    interp_config config = interp_default_config();
+    interp_config_set_blend(&config, true);
+    interp_set_config(interp0, 0, &config);
+    config = interp_default_config();
+    interp_config_set_shift(&config, KERNELS_FRACTION_BITS);
+    interp_config_set_mask(&config, 0, 7);
+    interp_set_config(interp0, 1, &config);
+
+    static const unsigned char shifts[3] = { 11, 5, 0 };
+    static const unsigned char masks[3] = { 0x1f, 0x3f, 0x1f };
+    for(unsigned int channel = 0; channel < 3; channel++)
+    {
+        unsigned int shift = shifts[channel];
+        interp0->base[0] = (from >> shift) & masks[channel];
+        interp0->base[1] = (to >> shift) & masks[channel];
+
+        unsigned int alpha = 0;
+        if(channel == 0)
+        {
+            for(unsigned int i = 0; i < count; i++, alpha += step)
+            {
+                interp0->accum[1] = alpha;
+                colors[i] = interp0->peek[1] << shift;
+            }
+        }
+        else
+        {
+            for(unsigned int i = 0; i < count; i++, alpha += step)
+            {
+                interp0->accum[1] = alpha;
+                colors[i] |= interp0->peek[1] << shift;
+            }
+        }
+    }
+
+    interp_restore(interp0, &saved);
+}
+
+/**
+ * @brief Set up a linear gradient across a circle, at an angle
+ * @param x the center of the circle on the screen
+ * @param y the center of the circle on the screen
+ * @param radius the radius of the circle, the gradient runs across its diameter
+ * @param angle the direction of the gradient in degrees, 0 runs from left to right
+ * @param from the color on the one side of the circle, in RGB565
+ * @param to the color on the other side of the circle, in RGB565
+ * @note Everything outside of the circle takes the color of the nearest end
+*/
+void Kernels::setLinear(int x, int y, unsigned int radius, int angle, unsigned short from, unsigned short to)
+{
+    this->ramp(this->linearRamp, KERNELS_RAMP_SIZE, from, to);
+    radius = MAX(radius, 1);
+
+    // the ramp index is the distance along the gradient, scaled so the diameter covers the ramp
+    float radians = angle * (float)M_PI / 180.0f;
+    float scale = (float)(KERNELS_RAMP_SIZE << KERNELS_FRACTION_BITS) / (2 * radius);
+    float cosine = cosf(radians) * scale;
+    float sine = sinf(radians) * scale;
+
+    this->linearStepX = (int)cosine;
+    this->linearStepY = (int)sine;
+    this->linearStart = (int)(radius * scale - x * cosine - y * sine);
+}
+
+/**
+ * @brief Draw the linear gradient
+ * @param pixels the pixel at the top left corner of the area
+ * @param stride the number of pixels from one row to the next
+ * @param area the area of the screen to draw
+*/
+void HOT_FUNC(Kernels::linear)(unsigned short* pixels, unsigned int stride, Screen_Rect area)
+{
+    const long long limit = KERNELS_RAMP_SIZE << KERNELS_FRACTION_BITS;
+    const int step = this->linearStepX;
+
+    interp_hw_save_t saved;
+    if(this->interpolator)
+    {
+        interp_save(this->interp, &saved);
+
+        // lane 0 steps along the row, its whole part times two is added onto the ramp address
+        interp_config config = interp_default_config();
+        interp_config_set_add_raw(&config, true);
+        interp_config_set_shift(&config, KERNELS_FRACTION_BITS - 1);
+        interp_config_set_mask(&config, 1, 8);
+        interp_set_config(this->interp, 0, &config);
+
+        // lane 1 is left at zero so it adds nothing
+        config = interp_default_config();
+        interp_set_config(this->interp, 1, &config);
+        this->interp->accum[1] = 0;
+        interp_set_base(this->interp, 1, 0);
+
+        interp_set_base(this->interp, 0, step);
+        interp_set_base(this->interp, 2, (uintptr_t)this->linearRamp);
+    }
+
+    for(unsigned int row = 0; row < area.height; row++)
+    {
+        unsigned short* line = &pixels[row * stride];
+        long long t = this->linearStart + (long long)area.x * step + (long long)(area.y + row) * this->linearStepY;
+
+        // work out which part of the row falls inside of the ramp, the rest is clamped to its ends
+        long long first = 0;
+        long long end = area.width;
+        if(step > 0)
+        {
+            if(t < 0)
+                first = (-t + step - 1) / step;
+            end = (limit - t + step - 1) / step;
+        }
+        else if(step < 0)
+        {
+            if(t >= limit)
+                first = (t - limit) / -step + 1;
+            end = t >= 0 ? t / -step + 1 : 0;
+        }
+        else if(t < 0 || t >= limit)
+            end = 0;
+        first = MIN(MAX(first, 0), (long long)area.width);
+        end = MIN(MAX(end, first), (long long)area.width);
+
+        unsigned short before = (step > 0 || t < 0) ? this->linearRamp[0] : this->linearRamp[KERNELS_RAMP_SIZE - 1];
+        unsigned short after = (step > 0 || (step == 0 && t >= 0)) ? this->linearRamp[KERNELS_RAMP_SIZE - 1] : this->linearRamp[0];
+        for(unsigned int i = 0; i < first; i++)
+            line[i] = before;
+        for(unsigned int i = end; i < area.width; i++)
+            line[i] = after;
+
+        if(this->interpolator)
+            this->linearRowInterpolated(&line[first], (int)(t + first * step), end - first);
+        else
+            this->linearRow(&line[first], (int)(t + first * step), end - first);
+    }
+
+    if(this->interpolator)
+        interp_restore(this->interp, &saved);
+}
+
+/**
+ * @brief Strip layer, draws the linear gradient into the band
+ * @param band the pixels of the band
+ * @param area the area of the screen the band covers
+ * @param context the Kernels
+*/
+void Kernels::linearLayer(unsigned short* band, Screen_Rect area, void* context)
+{
+    ((Kernels*)context)->linear(band, area.width, area);
+}
+
+/**
+ * @brief Set up a radial gradient
+ * @param x the center on the screen
+ * @param y the center on the screen
+ * @param radius the distance at which the gradient ends
+ * @param from the color at the center, in RGB565
+ * @param to the color at the radius and beyond, in RGB565
+ * @note The colors are looked up by the squared distance, so there is no square root per pixel. The
+ * table is spread evenly over the squared distance, which makes the steps coarser towards the center.
+*/
+void Kernels::setRadial(int x, int y, unsigned int radius, unsigned short from, unsigned short to)
+{
+    unsigned short colors[KERNELS_RAMP_SIZE];
+    this->ramp(colors, KERNELS_RAMP_SIZE, from, to);
+
+    radius = MIN(MAX(radius, 1), 2047);
+    this->radialX = x;
+    this->radialY = y;
+    this->radialLimit = radius * radius;
+    this->radialOutside = to;
+
+    // the table has to cover every squared distance inside of the radius, and the interpolator needs a shift of one or more
+    this->radialShift = 1;
+    while(((this->radialLimit - 1) >> this->radialShift) >= (1u << KERNELS_RADIAL_BITS))
+        this->radialShift++;
+
+    for(unsigned int i = 0; i < (1u << KERNELS_RADIAL_BITS); i++)
+    {
+        // the middle of the squared distances of the entry, the root comes out with 4 fractional bits
+        unsigned int d2 = (i << this->radialShift) + (1 << (this->radialShift - 1));
+        unsigned int index = this->squareRoot(d2 << 8) * (KERNELS_RAMP_SIZE / 16) / radius;
+        this->radialTable[i] = colors[MIN(index, KERNELS_RAMP_SIZE - 1)];
+    }
+}
+
+/**
+ * @brief Draw the radial gradient
+ * @param pixels the pixel at the top left corner of the area
+ * @param stride the number of pixels from one row to the next
+ * @param area the area of the screen to draw
+*/
+void Kernels::radial(unsigned short* pixels, unsigned int stride, Screen_Rect area)
+{
+    interp_hw_save_t saved;
+    if(this->interpolator)
+    {
+        interp_save(this->interp, &saved);
+
+        // lane 0 holds the squared distance and adds the step onto it, its top bits times two pick the entry
+        interp_config config = interp_default_config();
+        interp_config_set_add_raw(&config, true);
+        interp_config_set_shift(&config, this->radialShift - 1);
+        interp_config_set_mask(&config, 1, KERNELS_RADIAL_BITS);
+        interp_set_config(this->interp, 0, &config);
+
+        config = interp_default_config();
+        interp_set_config(this->interp, 1, &config);
+        this->interp->accum[1] = 0;
+        interp_set_base(this->interp, 1, 0);
+
+        interp_set_base(this->interp, 2, (uintptr_t)this->radialTable);
+    }
+
+    for(unsigned int row = 0; row < area.height; row++)
+    {
+        unsigned short* line = &pixels[row * stride];
+        int dy = (int)(area.y + row) - this->radialY;
+        unsigned int dy2 = dy * dy;
+
+        // only the part of the row inside of the radius is looked up
+        int left = (int)area.x + (int)area.width;
+        int right = left;
+        if(dy2 < this->radialLimit)
+        {
+            int half = this->squareRoot(this->radialLimit - 1 - dy2);
+            left = MAX(this->radialX - half, (int)area.x);
+            right = MIN(this->radialX + half + 1, (int)(area.x + area.width));
+            right = MAX(right, left);
+        }
+
+        unsigned int first = MIN(left - (int)area.x, (int)area.width);
+        unsigned int end = right - area.x;
+        for(unsigned int i = 0; i < first; i++)
+            line[i] = this->radialOutside;
+        for(unsigned int i = end; i < area.width; i++)
+            line[i] = this->radialOutside;
+
+        // stepping one pixel to the right adds 2 * dx + 1 onto the squared distance
+        int dx = left - this->radialX;
+        if(this->interpolator)
+            this->radialRowInterpolated(&line[first], dx * dx + dy2, 2 * dx + 1, end - first);
+        else
+            this->radialRow(&line[first], dx * dx + dy2, 2 * dx + 1, end - first);
+    }
+
+    if(this->interpolator)
+        interp_restore(this->interp, &saved);
+}
+
+/**
+ * @brief Strip layer, draws the radial gradient into the band
+ * @param band the pixels of the band
+ * @param area the area of the screen the band covers
+ * @param context the Kernels
+*/
+void Kernels::radialLayer(unsigned short* band, Screen_Rect area, void* context)
+{
+    ((Kernels*)context)->radial(band, area.width, area);
+}
+
+/**
+ * @brief Draw a texture rotated around a point, repeated over the entire area
+ * @param pixels the pixel at the top left corner of the area
+ * @param stride the number of pixels from one row to the next
+ * @param area the area of the screen to draw
+ * @param texture the texture, square and packed, in RGB565
+ * @param bits the size of the texture as a power of two, from 1 to 15
+ * @param x where the center of the texture goes on the screen
+ * @param y where the center of the texture goes on the screen
+ * @param angle the rotation in degrees, clockwise
+ * @note The texture coordinates step by a constant amount along a row, so each pixel is a single
+ * add for the interpolator. It also wraps them and turns them into the address of the texel.
+*/
+void Kernels::rotate(unsigned short* pixels, unsigned int stride, Screen_Rect area,
+    const unsigned short* texture, unsigned int bits, int x, int y, int angle)
+{
+    if(bits < 1 || bits > 15)
+        return;
+    const unsigned int mask = (1 << bits) - 1;
+    const unsigned int center = 1 << (bits - 1 + KERNELS_FRACTION_BITS);
+
+    // walking along a row of the screen walks the texture in the direction of the rotation
+    float radians = angle * (float)M_PI / 180.0f;
+    int cosine = (int)(cosf(radians) * (1 << KERNELS_FRACTION_BITS));
+    int sine = (int)(sinf(radians) * (1 << KERNELS_FRACTION_BITS));
+    unsigned int du = cosine;
+    unsigned int dv = -sine;
+
+    interp_hw_save_t saved;
+    if(this->interpolator)
+    {
+        interp_save(this->interp, &saved);
+
+        // lane 0 is the column times two, lane 1 the row times the size of a row of texels
+        interp_config config = interp_default_config();
+        interp_config_set_add_raw(&config, true);
+        interp_config_set_shift(&config, KERNELS_FRACTION_BITS - 1);
+        interp_config_set_mask(&config, 1, bits);
+        interp_set_config(this->interp, 0, &config);
+        interp_config_set_shift(&config, KERNELS_FRACTION_BITS - 1 - bits);
+        interp_config_set_mask(&config, bits + 1, 2 * bits);
+        interp_set_config(this->interp, 1, &config);
+
+        interp_set_base(this->interp, 0, du);
+        interp_set_base(this->interp, 1, dv);
+        interp_set_base(this->interp, 2, (uintptr_t)texture);
+    }
+
+    for(unsigned int row = 0; row < area.height; row++)
+    {
+        unsigned short* line = &pixels[row * stride];
+        int rx = (int)area.x - x;
+        int ry = (int)(area.y + row) - y;
+        unsigned int u = center + cosine * rx + sine * ry;
+        unsigned int v = center - sine * rx + cosine * ry;
+        unsigned int count = area.width;
+
+        if(this->interpolator)
+        {
+            this->interp->accum[0] = u;
+            this->interp->accum[1] = v;
+            for(; count >= 4; count -= 4)
+            {
+                line[0] = *(const unsigned short*)this->interp->pop[2];
+                line[1] = *(const unsigned short*)this->interp->pop[2];
+                line[2] = *(const unsigned short*)this->interp->pop[2];
+                line[3] = *(const unsigned short*)this->interp->pop[2];
+                line += 4;
+            }
+            while(count-- > 0)
+                *line++ = *(const unsigned short*)this->interp->pop[2];
+        }
+        else
+        {
+            for(unsigned int i = 0; i < count; i++, u += du, v += dv)
+                line[i] = texture[(((v >> KERNELS_FRACTION_BITS) & mask) << bits) | ((u >> KERNELS_FRACTION_BITS) & mask)];
+        }
+    }
+
+    if(this->interpolator)
+        interp_restore(this->interp, &saved);
+}
+
+/**
+ * @private
+ * @brief Integer square root
+ * @param value the value
+ * @return the square root, rounded down
+*/
+unsigned int Kernels::squareRoot(unsigned int value)
+{
+    unsigned int root = 0;
+    unsigned int bit = 1u << 30;
+    while(bit > value)
+        bit >>= 2;
+
+    while(bit != 0)
+    {
+        if(value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+            root >>= 1;
+        bit >>= 2;
+    }
+    return root;
+}
+
+/**
+ * @private
+ * @brief Draw a row of the linear gradient one by one
+ * @param pixels where the colors go
+ * @param t the ramp index of the first pixel in 16.16, inside of the ramp for the entire row
+ * @param count the number of pixels
+*/
+void HOT_FUNC(Kernels::linearRow)(unsigned short* pixels, int t, unsigned int count)
+{
+    const int step = this->linearStepX;
+    for(unsigned int i = 0; i < count; i++, t += step)
+        pixels[i] = this->linearRamp[t >> KERNELS_FRACTION_BITS];
+}
+
+/**
+ * @private
+ * @brief Draw a row of the linear gradient through the interpolator, four at a time
+ * @param pixels where the colors go
+ * @param t the ramp index of the first pixel in 16.16, inside of the ramp for the entire row
+ * @param count the number of pixels
+ * @note The interpolator has to be set up by linear(). Every pop hands out the address of the color
+ * and steps the index, so a pixel is a load from the interpolator, a load and a store.
+*/
+void HOT_FUNC(Kernels::linearRowInterpolated)(unsigned short* pixels, int t, unsigned int count)
+{
+    this->interp->accum[0] = t;
+    for(; count >= 4; count -= 4)
+    {
+        pixels[0] = *(const unsigned short*)this->interp->pop[2];
+        pixels[1] = *(const unsigned short*)this->interp->pop[2];
+        pixels[2] = *(const unsigned short*)this->interp->pop[2];
+        pixels[3] = *(const unsigned short*)this->interp->pop[2];
+        pixels += 4;
+    }
+    while(count-- > 0)
+        *pixels++ = *(const unsigned short*)this->interp->pop[2];
+}
+
+/**
+ * @private
+ * @brief Draw a row of the radial gradient one by one
+ * @param pixels where the colors go
+ * @param d2 the squared distance of the first pixel, inside of the radius for the entire row
+ * @param dd the amount the squared distance grows by to the next pixel
+ * @param count the number of pixels
+*/
+void Kernels::radialRow(unsigned short* pixels, unsigned int d2, int dd, unsigned int count)
+{
+    const unsigned int shift = this->radialShift;
+    for(unsigned int i = 0; i < count; i++)
+    {
+        pixels[i] = this->radialTable[d2 >> shift];
+        d2 += dd;
+        dd += 2;
+    }
+}
+
+/**
+ * @private
+ * @brief Draw a row of the radial gradient through the interpolator
+ * @param pixels where the colors go
+ * @param d2 the squared distance of the first pixel, inside of the radius for the entire row
+ * @param dd the amount the squared distance grows by to the next pixel
+ * @param count the number of pixels
+ * @note The interpolator has to be set up by radial(). Every pop hands out the address of the color
+ * and adds the step onto the squared distance, only the step itself is left to update.
+*/
+void Kernels::radialRowInterpolated(unsigned short* pixels, unsigned int d2, int dd, unsigned int count)
+{
+    this->interp->accum[0] = d2;
+    this->interp->base[0] = dd;
+    for(; count >= 2; count -= 2)
+    {
+        pixels[0] = *(const unsigned short*)this->interp->pop[2];
+        this->interp->base[0] = dd += 2;
+        pixels[1] = *(const unsigned short*)this->interp->pop[2];
+        this->interp->base[0] = dd += 2;
+        pixels += 2;
+    }
+    if(count > 0)
+        *pixels = *(const unsigned short*)this->interp->pop[2];
+}
@@ -0,0 +1,101 @@
+#include "Pacer.hpp"
+
+/**
+ * @brief Construct a new Pacer:: Pacer object
+ * @param maxFPS the maximum number of frames per second, 0 renders every time it is asked
+ * @param maxInterval the longest time between two frames in microseconds, even if nothing changed
+*/
+Pacer::Pacer(unsigned int maxFPS, unsigned int maxInterval)
+{
+    this->setMaxFPS(maxFPS);
+    this->maxInterval = maxInterval;
+}
+
+/**
+ * @brief Set the frame rate cap
+ * @param maxFPS the maximum number of frames per second, 0 disables pacing entirely
+*/
+void Pacer::setMaxFPS(unsigned int maxFPS)
+{
+    this->minInterval = maxFPS > 0 ? 1000000 / maxFPS : 0;
+}
+
+/**
+ * @brief Set the longest time between two frames
+ * @param maxInterval the interval in microseconds
+*/
+void Pacer::setMaxInterval(unsigned int maxInterval)
+{
+    this->maxInterval = maxInterval;
+}
+
+/**
+ * @brief Ask for a new frame, because something visible changed
+*/
+void Pacer::request()
+{
+    this->requested = true;
+}
+
+/**
+ * @brief Keep asking for frames while something is animating
+ * @param animating true while an animation is running
+*/
+void Pacer::animate(bool animating)
+{
+    this->animating = animating;
+}
+
+/**
+ * @brief Check if a frame should be rendered now
+ * @return true if something changed and the frame rate cap allows it, or if the last frame is too old
+*/
+bool Pacer::isDue()
+{
+    // pacing is turned off, render every time
+    if(this->minInterval == 0)
+        return true;
+
+    unsigned int elapsed = time_us_32() - this->lastFrame;
+    if(elapsed >= this->maxInterval)
+        return true;
+
+    return (this->requested || this->animating) && elapsed >= this->minInterval;
+}
+
+/**
+ * @brief Mark the start of a frame
+*/
+void Pacer::beginFrame()
+{
+    this->frameStart = time_us_32();
+    this->lastFrame = this->frameStart;
+    this->requested = false;
+}
+
+/**
+ * @brief Mark the end of a frame, the time in between counts towards the load
+*/
+void Pacer::endFrame()
+{
+    unsigned int now = time_us_32();
+    this->busy += now - this->frameStart;
+
+    // work out the fraction of time spent rendering over the last period
+    unsigned int period = now - this->loadTimer;
+    if(period >= PACER_LOAD_PERIOD)
+    {
+        this->load = (unsigned int)(((unsigned long long)this->busy * 1000) / period);
+        this->busy = 0;
+        this->loadTimer = now;
+    }
+}
+
+/**
+ * @brief Get the fraction of time spent rendering
+ * @return the load in per mille, over the last second
+*/
+unsigned int Pacer::getLoad()
+{
+    return this->load;
+}
@@ -0,0 +1,719 @@
+#include "Screen.hpp"
+#include "Screen.pio.h"
+
+Screen* Screen::instance = nullptr;
+
+/**
+ * @brief Construct a new Screen:: Screen object
+ * @param config the screen configuration
+ * @param frameBuffer the frame buffer that is pushed to the display
+*/
+Screen::Screen(screen_config_t* config, unsigned short* frameBuffer)
+{
+    this->config = config;
+    this->frameBuffer = frameBuffer;
+}
+
+/**
+ * @brief Initialize the screen
+ * @note The display and the SPI bus have to be initialized already
+*/
+void Screen::init()
+{
+    this->dmaChannel = dma_claim_unused_channel(true);
+
+    // stream 16 bit pixels from memory into the transmit FIFO
+    dma_channel_config dmaConfig = dma_channel_get_default_config(this->dmaChannel);
+    channel_config_set_transfer_data_size(&dmaConfig, DMA_SIZE_16);
+    channel_config_set_read_increment(&dmaConfig, true);
+    channel_config_set_write_increment(&dmaConfig, false);
+
+    if(this->config->pio != nullptr)
+    {
+        // the state machine takes the clock, data and data/command pins over from the SPI
+        PIO pio = this->config->pio;
+        unsigned int offset = pio_add_program(pio, &screen_tx_program);
+        this->sm = pio_claim_unused_sm(pio, true);
+        screen_tx_program_init(pio, this->sm, offset, this->config->dc, this->config->sck, this->config->mosi,
+            this->config->pioDivider);
+
+        // a 16 bit write ends up in both halves of the FIFO entry, the state machine shifts out the top one
+        channel_config_set_dreq(&dmaConfig, pio_get_dreq(pio, this->sm, true));
+        dma_channel_configure(this->dmaChannel, &dmaConfig, &pio->txf[this->sm], this->frameBuffer, 0, false);
+    }
+    else
+    {
+        channel_config_set_dreq(&dmaConfig, spi_get_dreq(this->config->spi, true));
+        dma_channel_configure(this->dmaChannel, &dmaConfig, &spi_get_hw(this->config->spi)->dr,
+            this->frameBuffer, 0, false);
+    }
+
+    // the end of each asynchronous transfer is picked up by the DMA interrupt
+    Screen::instance = this;
+    dma_channel_set_irq0_enabled(this->dmaChannel, true);
+    irq_add_shared_handler(DMA_IRQ_0, Screen::irqHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    this->frameTimer = time_us_32();
+}
+
+/**
+ * @brief Mark an area of the frame buffer as changed
+ * @param x the left edge in pixels
+ * @param y the top edge in pixels
+ * @param width the width in pixels
+ * @param height the height in pixels
+*/
+void Screen::invalidate(unsigned int x, unsigned int y, unsigned int width, unsigned int height)
+{
+    this->invalidate({x, y, width, height});
+}
+
+/**
+ * @brief Mark an area of the frame buffer as changed
+ * @param rect the area that changed
+ * @note Overlapping areas are merged, if we run out of space the last area grows to fit
+*/
+void Screen::invalidate(Screen_Rect rect)
+{
+    // clip the area to the screen
+    if(rect.x >= this->config->width || rect.y >= this->config->height)
+        return;
+    if(rect.width > this->config->width - rect.x)
+        rect.width = this->config->width - rect.x;
+    if(rect.height > this->config->height - rect.y)
+        rect.height = this->config->height - rect.y;
+    if(rect.width == 0 || rect.height == 0)
+        return;
+
+    // swallow every area that touches the new one, the grown area might touch others so start over
+    unsigned int i = 0;
+    while(i < this->dirtyCount)
+    {
+        if(!this->touches(this->dirtyRects[i], rect))
+        {
+            i++;
+            continue;
+        }
+
+        rect = this->merge(this->dirtyRects[i], rect);
+        this->dirtyRects[i] = this->dirtyRects[--this->dirtyCount];
+        i = 0;
+    }
+
+    if(this->dirtyCount < SCREEN_MAX_DIRTY_RECTS)
+        this->dirtyRects[this->dirtyCount++] = rect;
+    else
+        this->dirtyRects[this->dirtyCount - 1] = this->merge(this->dirtyRects[this->dirtyCount - 1], rect);
+}
+
+/**
+ * @brief Mark the entire frame buffer as changed
+*/
+void Screen::invalidateAll()
+{
+    this->dirtyRects[0] = {0, 0, this->config->width, this->config->height};
+    this->dirtyCount = 1;
+}
+
+/**
+ * @brief Check if anything has changed since the last update
+ * @return true if there is something to push to the display
+*/
+bool Screen::isDirty()
+{
+    return this->dirtyCount > 0;
+}
+
+/**
+ * @brief Push the changed areas of the frame buffer to the display
+ * @note Blocks until the pixels have left the SPI bus
+*/
+void Screen::update()
+{
+    // an asynchronous transfer might still own the bus
+    this->wait();
+
+    gpio_put(this->config->cs, 0);
+
+    for(unsigned int i = 0; i < this->dirtyCount; i++)
+    {
+        Screen_Rect rect = this->dirtyRects[i];
+        this->setWindow(rect);
+
+        // full width areas are contiguous in the frame buffer, everything else goes row by row
+        const unsigned short* pixels = &this->frameBuffer[rect.y * this->config->width + rect.x];
+        if(rect.width == this->config->width)
+            this->writePixels(pixels, rect.width * rect.height);
+        else
+            for(unsigned int row = 0; row < rect.height; row++)
+                this->writePixels(pixels + row * this->config->width, rect.width);
+    }
+
+    this->writeScroll();
+    this->waitForPIO();
+    gpio_put(this->config->cs, 1);
+    this->dirtyCount = 0;
+    this->countFrame();
+}
+
+/**
+ * @brief Set the buffer the changed areas are copied into while they are streamed to the display
+ * @param buffer the transfer buffer
+ * @param size the size of the buffer in pixels
+ * @note Without a transfer buffer submit() falls back to a blocking update()
+*/
+void Screen::setTransferBuffer(unsigned short* buffer, unsigned int size)
+{
+    this->wait();
+    this->transferBuffer = buffer;
+    this->transferSize = size;
+}
+
+/**
+ * @brief Mark the start of rendering a new frame
+ * @note Only used for the timing
+*/
+void Screen::beginFrame()
+{
+    this->renderStart = time_us_32();
+}
+
+/**
+ * @brief Hand the changed areas over to the DMA and return right away
+ * @note This only blocks if the previous frame is still being transferred. The changed areas
+ * are copied to the transfer buffer, so rendering can carry on in the frame buffer immediately.
+ * Areas bigger than the buffer go through it in chunks, this then blocks until all but the last
+ * buffer full of them are out.
+*/
+void Screen::submit()
+{
+    unsigned int renderEnd = time_us_32();
+
+    // the fence, both buffers are busy if the previous frame has not left yet
+    this->wait();
+    this->timing.wait = time_us_32() - renderEnd;
+    this->timing.render = renderEnd - this->renderStart;
+
+    // the previous transfer overlapped with the render for as long as both were running
+    unsigned int overlapStart = MAX(this->transferStart, this->renderStart);
+    unsigned int overlapEnd = MIN(this->transferEnd, renderEnd);
+    this->timing.overlap = (overlapEnd > overlapStart) ? overlapEnd - overlapStart : 0;
+
+    // figure out if the changed areas fit in the transfer buffer
+    unsigned int pixels = 0;
+    for(unsigned int i = 0; i < this->dirtyCount; i++)
+        pixels += this->dirtyRects[i].width * this->dirtyRects[i].height;
+    this->timing.pixels = pixels;
+
+    if(pixels == 0)
+    {
+        // the bus is idle, so a new scroll position can go out right away
+        if(this->scrollPending)
+        {
+            gpio_put(this->config->cs, 0);
+            this->writeScroll();
+            this->waitForPIO();
+            gpio_put(this->config->cs, 1);
+        }
+        this->countFrame();
+        return;
+    }
+
+    // nowhere to put them, or no room for a row in each half of the buffer, push them out the slow way
+    if(this->transferBuffer == nullptr || (pixels > this->transferSize && this->transferSize / 2 < this->config->width))
+    {
+        unsigned int transferStart = time_us_32();
+        this->update();
+        this->timing.transfer = time_us_32() - transferStart;
+        return;
+    }
+
+    // whatever fits goes through the buffer in one go. Anything bigger goes through it in chunks of half
+    // the buffer, one half is filled while the other one is going out, and the last two are still going
+    // out when this returns
+    unsigned int chunk = pixels <= this->transferSize ? this->transferSize : this->transferSize / 2;
+    unsigned int halfEnd[2] = {0, 0};
+    unsigned int half = 0;
+    unsigned int offset = 0;
+    unsigned int count = 0;
+
+    this->jobIndex = 0;
+    this->jobCount = 0;
+    this->jobsOpen = true;
+    this->transferStart = time_us_32();
+    for(unsigned int i = 0; i < this->dirtyCount; i++)
+    {
+        Screen_Rect rect = this->dirtyRects[i];
+        unsigned int row = 0;
+        while(row < rect.height)
+        {
+            // pack as many rows as are left in the current chunk
+            unsigned int rows = MIN(rect.height - row, (chunk - offset) / rect.width);
+            if(rows == 0)
+            {
+                // the chunk is full, send it and wait for the other half to be free again
+                this->queueJobs(count, false);
+                halfEnd[half] = count;
+                half ^= 1;
+                offset = 0;
+                unsigned int waitStart = time_us_32();
+                while(this->jobIndex < halfEnd[half])
+                    tight_loop_contents();
+                this->timing.wait += time_us_32() - waitStart;
+                continue;
+            }
+
+            unsigned short* pixels = &this->transferBuffer[half * chunk + offset];
+            for(unsigned int j = 0; j < rows; j++)
+                memcpy(&pixels[j * rect.width],
+                    &this->frameBuffer[(rect.y + row + j) * this->config->width + rect.x],
+                    rect.width * sizeof(unsigned short));
+
+            this->jobs[count % SCREEN_MAX_JOBS] = {rect.x, rect.y + row, rect.width, rows};
+            this->jobPixels[count % SCREEN_MAX_JOBS] = pixels;
+            count++;
+            offset += rows * rect.width;
+            row += rows;
+        }
+    }
+    this->dirtyCount = 0;
+
+    // the interrupt takes care of the rest, the frame buffer is free again
+    this->queueJobs(count, true);
+    this->countFrame();
+}
+
+/**
+ * @brief Stream a block of pixels to an area of the display and return right away
+ * @param rect the area on the screen
+ * @param pixels the pixels of the area, packed, they have to stay untouched until the transfer is done
+ * @note Waits for the previous transfer first. Nothing is copied and the dirty areas are left alone,
+ * this is for callers that render into their own buffers, like the strip renderer.
+*/
+void Screen::write(Screen_Rect rect, const unsigned short* pixels)
+{
+    this->wait();
+
+    this->jobs[0] = rect;
+    this->jobPixels[0] = pixels;
+    this->jobIndex = 0;
+    this->jobCount = 0;
+    this->jobsOpen = true;
+    this->transferStart = time_us_32();
+    this->queueJobs(1, true);
+}
+
+/**
+ * @brief Check if a transfer is still running
+ * @return true if the DMA is still streaming to the display
+*/
+bool Screen::isBusy()
+{
+    return this->busy;
+}
+
+/**
+ * @brief Wait for the running transfer to finish
+*/
+void Screen::wait()
+{
+    while(this->busy)
+        tight_loop_contents();
+}
+
+/**
+ * @brief Define the part of the display memory that scrolls
+ * @param top the number of fixed lines above the scrolling area
+ * @param lines the number of lines that scroll
+ * @param bottom the number of fixed lines below the scrolling area
+ * @note The lines run along the long side of the panel, all three have to add up to 320. In
+ * landscape this scrolls the picture sideways. Blocks until the running transfer is done.
+*/
+void Screen::setScrollArea(unsigned int top, unsigned int lines, unsigned int bottom)
+{
+    unsigned char data[6] =
+    {
+        (unsigned char)(top >> 8), (unsigned char)(top & 0xFF),
+        (unsigned char)(lines >> 8), (unsigned char)(lines & 0xFF),
+        (unsigned char)(bottom >> 8), (unsigned char)(bottom & 0xFF)
+    };
+
+    this->wait();
+    gpio_put(this->config->cs, 0);
+    this->writeCommand(ST7789_VSCRDEF, data, 6);
+    this->waitForPIO();
+    gpio_put(this->config->cs, 1);
+}
+
+/**
+ * @brief Set the line of the display memory that is shown first in the scrolling area
+ * @param line the line in the display memory
+ * @note The scroll position goes out with the next update() or submit(), after the pixels,
+ * so newly drawn lines and the scroll show up together
+*/
+void Screen::scroll(unsigned int line)
+{
+    this->scrollLine = line;
+    this->scrollPending = true;
+}
+
+/**
+ * @brief Put the panel into another power mode
+ * @param power the power mode
+ * @note Blocks until the running transfer is done. The display memory survives sleep, so the panel shows
+ * the same picture again right after waking up, without anything being sent. Waking up from sleep blocks
+ * for the 5ms the panel needs before it takes commands again.
+*/
+void Screen::setPower(Screen_Power power)
+{
+    if(power == this->power)
+        return;
+
+    this->wait();
+
+    // leave the current mode first, idle and sleep are independent of each other on the panel
+    if(this->power == SCREEN_POWER_SLEEP)
+    {
+        this->sendCommand(ST7789_SLPOUT);
+        this->wakeTime = time_us_32();
+        busy_wait_us_32(SCREEN_SLEEP_OUT_DELAY);
+        this->sendCommand(ST7789_DISPON);
+    }
+    else if(this->power == SCREEN_POWER_IDLE)
+        this->sendCommand(ST7789_IDMOFF);
+
+    if(power == SCREEN_POWER_IDLE)
+        this->sendCommand(ST7789_IDMON);
+    else if(power == SCREEN_POWER_SLEEP)
+    {
+        // the panel ignores sleep in for a while after sleep out
+        unsigned int awake = time_us_32() - this->wakeTime;
+        if(awake < SCREEN_SLEEP_IN_DELAY)
+            busy_wait_us_32(SCREEN_SLEEP_IN_DELAY - awake);
+        this->sendCommand(ST7789_DISPOFF);
+        this->sendCommand(ST7789_SLPIN);
+    }
+
+    this->power = power;
+}
+
+/**
+ * @brief Get the power mode of the panel
+ * @return the power mode
+*/
+Screen_Power Screen::getPower()
+{
+    return this->power;
+}
+
+/**
+ * @brief Get the number of frames pushed to the display over the last second
+ * @return the frame rate
+*/
+unsigned int Screen::getFrameCounter()
+{
+    return this->frameCounter;
+}
+
+/**
+ * @brief Get the timing of the last frame
+ * @return the timing
+*/
+Screen_Timing Screen::getTiming()
+{
+    return this->timing;
+}
+
+/**
+ * @brief Get the clock the display is driven with
+ * @return the clock in Hz
+*/
+unsigned int Screen::getClock()
+{
+    if(this->config->pio != nullptr)
+        return (unsigned int)(clock_get_hz(clk_sys) / (2 * this->config->pioDivider));
+    return spi_get_baudrate(this->config->spi);
+}
+
+/**
+ * @private
+ * @brief Check if two areas overlap or share an edge
+ * @param a the first area
+ * @param b the second area
+ * @return true if the areas can be merged without covering much extra
+*/
+bool Screen::touches(Screen_Rect a, Screen_Rect b)
+{
+    return a.x <= b.x + b.width && b.x <= a.x + a.width &&
+        a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+
+/**
+ * @private
+ * @brief Get the smallest area covering two areas
+ * @param a the first area
+ * @param b the second area
+ * @return the bounding area
+*/
+Screen_Rect Screen::merge(Screen_Rect a, Screen_Rect b)
+{
+    unsigned int x0 = MIN(a.x, b.x);
+    unsigned int y0 = MIN(a.y, b.y);
+    unsigned int x1 = MAX(a.x + a.width, b.x + b.width);
+    unsigned int y1 = MAX(a.y + a.height, b.y + b.height);
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+/**
+ * @private
+ * @brief Send a command with parameters to the display
+ * @param command the command
+ * @param data the parameters
+ * @param length the number of parameters, has to be even with PIO
+ * @param pixels the number of pixels that follow the command, only needed with PIO
+*/
+void Screen::writeCommand(unsigned char command, const unsigned char* data, unsigned int length, unsigned int pixels)
+{
+    if(this->config->pio != nullptr)
+    {
+        // the state machine drives the data/command pin, it only has to know how many bits of parameters follow
+        PIO pio = this->config->pio;
+        pio_sm_put_blocking(pio, this->sm, ((unsigned int)command << 24) | ((length * 8 + pixels * 16) & 0xFFFFFF));
+        for(unsigned int i = 0; i + 1 < length; i += 2)
+            pio_sm_put_blocking(pio, this->sm, (unsigned int)((data[i] << 8) | data[i + 1]) << 16);
+        return;
+    }
+
+    gpio_put(this->config->dc, 0);
+    spi_write_blocking(this->config->spi, &command, 1);
+    gpio_put(this->config->dc, 1);
+
+    if(length > 0)
+        spi_write_blocking(this->config->spi, data, length);
+}
+
+/**
+ * @private
+ * @brief Send a command without parameters on its own
+ * @param command the command
+*/
+void Screen::sendCommand(unsigned char command)
+{
+    gpio_put(this->config->cs, 0);
+    this->writeCommand(command, nullptr, 0);
+    this->waitForPIO();
+    gpio_put(this->config->cs, 1);
+}
+
+/**
+ * @private
+ * @brief Set the area of the display memory the next pixels are written to
+ * @param rect the area on the screen
+*/
+void Screen::setWindow(Screen_Rect rect)
+{
+    unsigned int x0 = rect.x + this->config->offsetX;
+    unsigned int x1 = x0 + rect.width - 1;
+    unsigned int y0 = rect.y + this->config->offsetY;
+    unsigned int y1 = y0 + rect.height - 1;
+
+    unsigned char columns[4] =
+    {
+        (unsigned char)(x0 >> 8), (unsigned char)(x0 & 0xFF),
+        (unsigned char)(x1 >> 8), (unsigned char)(x1 & 0xFF)
+    };
+    unsigned char rows[4] =
+    {
+        (unsigned char)(y0 >> 8), (unsigned char)(y0 & 0xFF),
+        (unsigned char)(y1 >> 8), (unsigned char)(y1 & 0xFF)
+    };
+
+    this->writeCommand(ST7789_CASET, columns, 4);
+    this->writeCommand(ST7789_RASET, rows, 4);
+    this->writeCommand(ST7789_RAMWR, nullptr, 0, rect.width * rect.height);
+}
+
+/**
+ * @private
+ * @brief Stream pixels to the display memory
+ * @param pixels the pixels in RGB565
+ * @param count the number of pixels
+ * @note Blocks until the pixels have left the DMA
+*/
+void Screen::writePixels(const unsigned short* pixels, unsigned int count)
+{
+    this->beginPixels();
+    dma_channel_transfer_from_buffer_now(this->dmaChannel, pixels, count);
+    dma_channel_wait_for_finish_blocking(this->dmaChannel);
+    this->endPixels();
+}
+
+/**
+ * @private
+ * @brief Get the bus ready for pixels
+*/
+void Screen::beginPixels()
+{
+    // the state machine takes 16 bit words either way
+    if(this->config->pio != nullptr)
+        return;
+
+    // switch to 16 bit frames so the pixels go out most significant byte first, the SPI mode is left alone
+    hw_write_masked(&spi_get_hw(this->config->spi)->cr0, (16 - 1) << SPI_SSPCR0_DSS_LSB, SPI_SSPCR0_DSS_BITS);
+}
+
+/**
+ * @private
+ * @brief Get the bus ready for commands again, once the DMA is done with the pixels
+*/
+void Screen::endPixels()
+{
+    // whatever is still in the FIFO goes out before the next header
+    if(this->config->pio != nullptr)
+        return;
+
+    // the last few pixels are still in the FIFO, then back to 8 bit frames for the commands
+    this->waitForSPI();
+    hw_write_masked(&spi_get_hw(this->config->spi)->cr0, (8 - 1) << SPI_SSPCR0_DSS_LSB, SPI_SSPCR0_DSS_BITS);
+}
+
+/**
+ * @private
+ * @brief Wait for the SPI bus to go idle and throw away whatever was received
+*/
+void Screen::waitForSPI()
+{
+    spi_hw_t* spi = spi_get_hw(this->config->spi);
+
+    while(spi_is_busy(this->config->spi))
+        tight_loop_contents();
+    while(spi_is_readable(this->config->spi))
+        (void)spi->dr;
+
+    // we never read anything back, so the receive FIFO has overflowed
+    spi->icr = SPI_SSPICR_RORIC_BITS;
+}
+
+/**
+ * @private
+ * @brief Wait for the state machine to shift out everything it was given
+ * @note Does nothing when transmitting through the SPI instance
+*/
+void Screen::waitForPIO()
+{
+    if(this->config->pio == nullptr)
+        return;
+
+    // the stall flag is set again right away if the state machine is already waiting for data
+    unsigned int stalled = 1u << (PIO_FDEBUG_TXSTALL_LSB + this->sm);
+    this->config->pio->fdebug = stalled;
+    while(!(this->config->pio->fdebug & stalled))
+        tight_loop_contents();
+}
+
+/**
+ * @private
+ * @brief Send the scroll position if it changed
+ * @note Chip select has to be low already, and the SPI bus in 8 bit mode
+*/
+void Screen::writeScroll()
+{
+    if(!this->scrollPending)
+        return;
+
+    unsigned char data[2] = { (unsigned char)(this->scrollLine >> 8), (unsigned char)(this->scrollLine & 0xFF) };
+    this->writeCommand(ST7789_VSCRSADD, data, 2);
+    this->scrollPending = false;
+}
+
+/**
+ * @private
+ * @brief Count the frames pushed over the last second
+*/
+void Screen::countFrame()
+{
+    this->frames++;
+    if((time_us_32() - this->frameTimer) > SCREEN_FRAME_COUNTER_PERIOD)
+    {
+        this->frameCounter = this->frames;
+        this->frames = 0;
+        this->frameTimer = time_us_32();
+    }
+}
+
+/**
+ * @private
+ * @brief Start streaming one of the packed areas to the display
+ * @param job the index of the area
+*/
+void Screen::startJob(unsigned int job)
+{
+    Screen_Rect rect = this->jobs[job % SCREEN_MAX_JOBS];
+    this->setWindow(rect);
+
+    // the interrupt wraps up once the pixels are out
+    this->beginPixels();
+    dma_channel_transfer_from_buffer_now(this->dmaChannel, this->jobPixels[job % SCREEN_MAX_JOBS],
+        rect.width * rect.height);
+}
+
+/**
+ * @private
+ * @brief Hand the jobs packed so far to the interrupt, and start it up again if it ran out of them
+ * @param count the number of jobs packed since the start of the frame
+ * @param last true if no more jobs follow for this frame
+ * @note The interrupt has to run on this core, it is held off while the count changes
+*/
+void Screen::queueJobs(unsigned int count, bool last)
+{
+    unsigned int interrupts = save_and_disable_interrupts();
+    this->jobCount = count;
+    this->jobsOpen = !last;
+    if(!this->busy && this->jobIndex < count)
+    {
+        this->busy = true;
+        gpio_put(this->config->cs, 0);
+        this->startJob(this->jobIndex);
+    }
+    restore_interrupts(interrupts);
+}
+
+/**
+ * @private
+ * @brief DMA interrupt handler, starts the next area or wraps up the transfer
+*/
+void Screen::irqHandler()
+{
+    Screen* screen = Screen::instance;
+    if(!dma_channel_get_irq0_status(screen->dmaChannel))
+        return;
+    dma_channel_acknowledge_irq0(screen->dmaChannel);
+
+    // the blocking transfers raise the interrupt as well, they take care of themselves
+    if(!screen->busy)
+        return;
+
+    screen->endPixels();
+
+    screen->jobIndex++;
+    if(screen->jobIndex < screen->jobCount)
+    {
+        screen->startJob(screen->jobIndex);
+        return;
+    }
+
+    // caught up with submit() in the middle of a frame, it starts the next chunk
+    if(screen->jobsOpen)
+    {
+        screen->busy = false;
+        return;
+    }
+
+    screen->writeScroll();
+    screen->waitForPIO();
+    gpio_put(screen->config->cs, 1);
+    screen->transferEnd = time_us_32();
+    screen->timing.transfer = screen->transferEnd - screen->transferStart;
+    screen->busy = false;
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include "Strip.hpp"
+
+/**
+ * @brief Construct a new Strip:: Strip object
+ * @param screen the screen the bands are streamed to
+ * @param buffer room for two bands, 2 * width * bandHeight pixels
+ * @param width the width of the screen in pixels
+ * @param height the height of the screen in pixels
+ * @param bandHeight the number of rows rendered at once
+ * @note One band is rendered while the other one is going out, so the buffer holds two of them
+*/
+Strip::Strip(Screen* screen, unsigned short* buffer, unsigned int width, unsigned int height, unsigned int bandHeight)
+{
+    this->screen = screen;
+    this->buffer = buffer;
+    this->width = width;
+    this->height = height;
+    this->bandHeight = bandHeight;
+}
+
+/**
+ * @brief Add a layer to the scene
+ * @param layer the function drawing the layer
+ * @param context passed along to the layer
+ * @return true if the layer was added
+ * @note The layers are drawn in the order they were added, the first one has to fill the entire band
+*/
+bool Strip::addLayer(Strip_Layer layer, void* context)
+{
+    if(this->layerCount >= STRIP_MAX_LAYERS)
+        return false;
+
+    this->layers[this->layerCount] = layer;
+    this->contexts[this->layerCount] = context;
+    this->layerCount++;
+    return true;
+}
+
+/**
+ * @brief Render a range of rows band by band and stream them to the display
+ * @param top the first row
+ * @param rows the number of rows
+ * @note Returns as soon as the last band is handed to the DMA, the screen has to be waited on
+ * before anything else uses the bus
+*/
+void Strip::render(unsigned int top, unsigned int rows)
+{
+    if(top >= this->height)
+        return;
+    rows = MIN(rows, this->height - top);
+
+    // the buffer might still be going out from an earlier transfer
+    this->screen->wait();
+
+    unsigned int half = 0;
+    for(unsigned int y = top; y < top + rows; y += this->bandHeight)
+    {
+        Screen_Rect area = {0, y, this->width, MIN(this->bandHeight, top + rows - y)};
+        unsigned short* band = &this->buffer[half * this->width * this->bandHeight];
+
+        for(unsigned int i = 0; i < this->layerCount; i++)
+            this->layers[i](band, area, this->contexts[i]);
+
+        // this waits for the other band, which had all the time this one took to render
+        this->screen->write(area, band);
+        half ^= 1;
+    }
+}
+
+/**
+ * @brief Render the entire screen
+*/
+void Strip::renderAll()
+{
+    this->render(0, this->height);
+}
+
+/**
+ * @brief Get the amount of memory the bands take up
+ * @return the size in bytes
+*/
+unsigned int Strip::getBufferSize()
+{
+    return 2 * this->width * this->bandHeight * sizeof(unsigned short);
+}
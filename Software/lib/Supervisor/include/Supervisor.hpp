@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/watchdog.h"
+#include "hardware/structs/watchdog.h"
+
+#define SUPERVISOR_MAX_TASKS            8
+#define SUPERVISOR_MAX_FAILSAFE_PINS    4
+#define SUPERVISOR_CHECK_INTERVAL       5000        // 5ms
+#define SUPERVISOR_WATCHDOG_TIMEOUT     1000        // 1s, in milliseconds
+#define SUPERVISOR_NO_TASK              0xff
+
+// watchdog scratch registers that survive the reset, 4 through 7 are used by the SDK
+#define SUPERVISOR_SCRATCH_MAGIC        0
+#define SUPERVISOR_SCRATCH_REASON       1
+#define SUPERVISOR_SCRATCH_TASK         2
+#define SUPERVISOR_MAGIC                0x5afe5afe
+
+typedef enum
+{
+    SUPERVISOR_RESET_POWER_ON = 0x00,
+    SUPERVISOR_RESET_WATCHDOG = 0x01,
+    SUPERVISOR_RESET_TASK_STALL = 0x02,
+    SUPERVISOR_RESET_SOFTWARE = 0x03,
+} Supervisor_Reset_Reason;
+
+/**
+ * @brief A supervised task
+ * @param timeout the maximum time between two heartbeats in microseconds
+ * @param lastHeartbeat the time of the last heartbeat
+ * @param core the core the last heartbeat came from
+ * @param enabled whether the task is being supervised
+*/
+struct Supervisor_Task
+{
+    unsigned int timeout;
+    volatile unsigned int lastHeartbeat;
+    volatile unsigned int core;
+    bool enabled;
+};
+
+class Supervisor
+{
+public:
+    Supervisor();
+
+    void addFailsafePin(unsigned int pin, bool safeState);
+    void addTask(unsigned int task, unsigned int timeout, bool feedsWatchdog = false);
+    void start();
+    void heartbeat(unsigned int task);
+    void failsafe();
+    void reboot();
+
+    Supervisor_Reset_Reason getResetReason();
+    unsigned int getStalledTask();
+private:
+    Supervisor_Task tasks[SUPERVISOR_MAX_TASKS] = {0};
+    unsigned int watchdogTask = SUPERVISOR_NO_TASK;
+    // the task each core is running, a stall is blamed on the one running on the core of the late task
+    volatile unsigned int activeTask[NUM_CORES] = { SUPERVISOR_NO_TASK, SUPERVISOR_NO_TASK };
+
+    unsigned int failsafePins[SUPERVISOR_MAX_FAILSAFE_PINS] = {0};
+    bool failsafeStates[SUPERVISOR_MAX_FAILSAFE_PINS] = {0};
+    unsigned int failsafePinCount = 0;
+
+    Supervisor_Reset_Reason resetReason = SUPERVISOR_RESET_POWER_ON;
+    unsigned int stalledTask = SUPERVISOR_NO_TASK;
+    repeating_timer_t timer;
+
+    void trip(Supervisor_Reset_Reason reason, unsigned int task);
+    static bool check(repeating_timer_t* timer);
+};
\ No newline at end of file
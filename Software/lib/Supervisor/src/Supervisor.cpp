@@ -0,0 +1,178 @@
+#include "Supervisor.hpp"
+
+/**
+ * @brief Construct a new Supervisor:: Supervisor object
+ * @note Figures out why we booted from the watchdog scratch registers and clears them
+*/
+Supervisor::Supervisor()
+{
+    // did we leave a note before the reset?
+    if(watchdog_hw->scratch[SUPERVISOR_SCRATCH_MAGIC] == SUPERVISOR_MAGIC)
+    {
+        this->resetReason = (Supervisor_Reset_Reason)watchdog_hw->scratch[SUPERVISOR_SCRATCH_REASON];
+        this->stalledTask = watchdog_hw->scratch[SUPERVISOR_SCRATCH_TASK];
+    }
+    // the watchdog ran out without the supervisor getting a chance to act
+    else if(watchdog_enable_caused_reboot())
+        this->resetReason = SUPERVISOR_RESET_WATCHDOG;
+    // someone else rebooted us through the watchdog
+    else if(watchdog_caused_reboot())
+        this->resetReason = SUPERVISOR_RESET_SOFTWARE;
+
+    // clear the note so the next reset is not mistaken for this one
+    watchdog_hw->scratch[SUPERVISOR_SCRATCH_MAGIC] = 0;
+    watchdog_hw->scratch[SUPERVISOR_SCRATCH_REASON] = 0;
+    watchdog_hw->scratch[SUPERVISOR_SCRATCH_TASK] = 0;
+}
+
+/**
+ * @brief Add a pin that is forced to a safe state before the supervisor resets the device
+ * @param pin the pin to force
+ * @param safeState the state the pin should be forced to
+ * @note The pin has to be initialized as an output by the caller
+*/
+void Supervisor::addFailsafePin(unsigned int pin, bool safeState)
+{
+    if(this->failsafePinCount >= SUPERVISOR_MAX_FAILSAFE_PINS)
+        return;
+
+    this->failsafePins[this->failsafePinCount] = pin;
+    this->failsafeStates[this->failsafePinCount] = safeState;
+    this->failsafePinCount++;
+}
+
+/**
+ * @brief Add a task to be supervised
+ * @param task the identifier of the task, has to be below SUPERVISOR_MAX_TASKS
+ * @param timeout the maximum time between two heartbeats in microseconds
+ * @param feedsWatchdog whether the heartbeat of this task feeds the hardware watchdog
+ * @note Only a single task can feed the hardware watchdog, the last one added wins
+*/
+void Supervisor::addTask(unsigned int task, unsigned int timeout, bool feedsWatchdog)
+{
+    if(task >= SUPERVISOR_MAX_TASKS)
+        return;
+
+    this->tasks[task].timeout = timeout;
+    this->tasks[task].lastHeartbeat = time_us_32();
+    this->tasks[task].enabled = true;
+
+    if(feedsWatchdog)
+        this->watchdogTask = task;
+}
+
+/**
+ * @brief Start supervising the tasks
+ * @note Enables the hardware watchdog, so the heartbeats have to start coming in right away
+*/
+void Supervisor::start()
+{
+    // give every task a fresh start, the setup might have taken a while
+    unsigned int now = time_us_32();
+    for(int i = 0; i < SUPERVISOR_MAX_TASKS; i++)
+        this->tasks[i].lastHeartbeat = now;
+
+    // check the heartbeats from the timer interrupt, this still runs when the loop is stuck
+    add_repeating_timer_us(-SUPERVISOR_CHECK_INTERVAL, Supervisor::check, this, &this->timer);
+    // and let the hardware watchdog catch the case where even the interrupts are dead
+    watchdog_enable(SUPERVISOR_WATCHDOG_TIMEOUT, true);
+}
+
+/**
+ * @brief Tell the supervisor that a task is alive and about to run
+ * @param task the identifier of the task
+*/
+void Supervisor::heartbeat(unsigned int task)
+{
+    if(task >= SUPERVISOR_MAX_TASKS)
+        return;
+
+    unsigned int core = get_core_num();
+    this->tasks[task].lastHeartbeat = time_us_32();
+    this->tasks[task].core = core;
+    this->activeTask[core] = task;
+
+    // only the watchdog task is allowed to keep the hardware watchdog happy
+    if(task == this->watchdogTask)
+        watchdog_update();
+}
+
+/**
+ * @brief Force all the failsafe pins into their safe state
+*/
+void Supervisor::failsafe()
+{
+    for(unsigned int i = 0; i < this->failsafePinCount; i++)
+        gpio_put(this->failsafePins[i], this->failsafeStates[i]);
+}
+
+/**
+ * @brief Reboot the device through the watchdog
+ * @note The failsafe pins are forced to their safe state first
+*/
+void Supervisor::reboot()
+{
+    this->trip(SUPERVISOR_RESET_SOFTWARE, SUPERVISOR_NO_TASK);
+}
+
+/**
+ * @brief Get the reason for the last reset
+ * @return the reason for the last reset
+*/
+Supervisor_Reset_Reason Supervisor::getResetReason()
+{
+    return this->resetReason;
+}
+
+/**
+ * @brief Get the task that was running when the supervisor caught a stall
+ * @return the task identifier, or SUPERVISOR_NO_TASK if the last reset was not a stall
+*/
+unsigned int Supervisor::getStalledTask()
+{
+    return this->stalledTask;
+}
+
+/**
+ * @private
+ * @brief Make the output safe, leave a note for the next boot and reset the device
+ * @param reason the reason for the reset
+ * @param task the task to blame
+*/
+void Supervisor::trip(Supervisor_Reset_Reason reason, unsigned int task)
+{
+    // the output goes first, everything else can wait
+    this->failsafe();
+
+    watchdog_hw->scratch[SUPERVISOR_SCRATCH_REASON] = reason;
+    watchdog_hw->scratch[SUPERVISOR_SCRATCH_TASK] = task;
+    watchdog_hw->scratch[SUPERVISOR_SCRATCH_MAGIC] = SUPERVISOR_MAGIC;
+
+    watchdog_reboot(0, 0, 0);
+    while(1);
+}
+
+/**
+ * @private
+ * @brief Timer callback that checks the heartbeats of all the tasks
+ * @param timer the repeating timer, carries the supervisor in its user data
+ * @return true to keep the timer running
+*/
+bool Supervisor::check(repeating_timer_t* timer)
+{
+    Supervisor* supervisor = (Supervisor*)timer->user_data;
+    unsigned int now = time_us_32();
+
+    for(int i = 0; i < SUPERVISOR_MAX_TASKS; i++)
+    {
+        Supervisor_Task* task = &supervisor->tasks[i];
+        if(!task->enabled)
+            continue;
+
+        // blame the task that was running on the same core, as it is the one keeping everyone else there from their heartbeat
+        if((now - task->lastHeartbeat) > task->timeout)
+            supervisor->trip(SUPERVISOR_RESET_TASK_STALL, supervisor->activeTask[task->core]);
+    }
+
+    return true;
+}
\ No newline at end of file
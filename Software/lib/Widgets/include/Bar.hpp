@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Widget.hpp"
+
+class Bar : public Widget
+{
+public:
+    Bar(unsigned short color, unsigned short track, Screen_Rect bounds = {0, 0, 0, 0});
+
+    void setRange(int maximum);
+    void setValue(int value);
+    int getValue();
+protected:
+    void draw(Widget_Canvas canvas) override;
+    bool isOpaque() override;
+private:
+    unsigned short color;
+    unsigned short track;
+    int maximum = 1;
+    int value = 0;
+    unsigned int filled = 0;
+
+    void fit();
+};
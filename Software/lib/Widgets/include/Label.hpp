@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Widget.hpp"
+
+#define LABEL_MAX_LENGTH    32
+
+class Label;
+
+/**
+ * @brief Draws the text of a label
+ * @param label the label, with the text, color and bounds to draw
+ * @param canvas the pixels to draw into
+ * @param context whatever was passed along with the font
+*/
+typedef void (*Label_Font)(Label* label, Widget_Canvas canvas, void* context);
+
+class Label : public Widget
+{
+public:
+    Label(Label_Font font, void* context = nullptr, Screen_Rect bounds = {0, 0, 0, 0});
+
+    void setText(const char* text);
+    const char* getText();
+    void setColor(unsigned int color);
+    unsigned int getColor();
+    void setCentered(bool centered);
+    bool isCentered();
+protected:
+    void draw(Widget_Canvas canvas) override;
+private:
+    Label_Font font;
+    void* context;
+    char text[LABEL_MAX_LENGTH] = {0};
+    unsigned int color = 0;
+    bool centered = false;
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Widget.hpp"
+
+#define PAGER_MAX_PAGES     WIDGET_MAX_CHILDREN
+
+/**
+ * @brief Hands the latest values to the widgets of a page, only called while the page is shown
+ * @param context whatever was passed along with the page
+*/
+typedef void (*Pager_Update)(void* context);
+
+/**
+ * @brief A page and what keeps it up to date
+ * @param page the widget holding the page
+ * @param update called while the page is shown, can be nullptr
+ * @param context passed along to the update
+*/
+struct Pager_Page
+{
+    Widget* page;
+    Pager_Update update;
+    void* context;
+};
+
+class Pager
+{
+public:
+    Pager(Widget* root);
+
+    bool add(Widget* page, Pager_Update update = nullptr, void* context = nullptr);
+    void show(unsigned int index);
+    void next();
+    void previous();
+    void update();
+
+    unsigned int getCurrent();
+    unsigned int getCount();
+private:
+    Widget* root;
+    Pager_Page pages[PAGER_MAX_PAGES];
+    unsigned int count = 0;
+    unsigned int current = 0;
+};
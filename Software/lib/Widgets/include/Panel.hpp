@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Widget.hpp"
+
+class Panel : public Widget
+{
+public:
+    Panel(unsigned short color, Screen_Rect bounds = {0, 0, 0, 0});
+
+    void setColor(unsigned short color);
+protected:
+    unsigned short color;
+
+    void draw(Widget_Canvas canvas) override;
+    bool isOpaque() override;
+    void erase(Widget_Canvas canvas, Screen_Rect rect, Background* background) override;
+};
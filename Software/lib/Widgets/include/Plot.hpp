@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Widget.hpp"
+#include "Graph.hpp"
+
+class Plot : public Widget
+{
+public:
+    Plot(Graph* graph, Screen_Rect bounds = {0, 0, 0, 0});
+protected:
+    void draw(Widget_Canvas canvas) override;
+    void update() override;
+    void shown(bool visible) override;
+    bool isOpaque() override;
+private:
+    Graph* graph;
+};
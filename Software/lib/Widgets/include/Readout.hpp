@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Widget.hpp"
+#include "GlyphCache.hpp"
+#include "Formatter.hpp"
+
+#define READOUT_MAX_LENGTH  16
+
+class Readout : public Widget
+{
+public:
+    Readout(GlyphCache* glyphs, Formatter* formatter, char unit, unsigned short color, Screen_Rect bounds = {0, 0, 0, 0});
+
+    void setValue(int value);
+    int getValue();
+    const char* getText();
+protected:
+    void draw(Widget_Canvas canvas) override;
+private:
+    GlyphCache* glyphs;
+    Formatter* formatter;
+    char unit;
+    unsigned short color;
+    int value = 0;
+    bool formatted = false;
+    char text[READOUT_MAX_LENGTH] = {0};
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Screen.hpp"
+#include "Background.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+
+#define WIDGET_MAX_CHILDREN     8
+
+/**
+ * @brief Where the widgets draw to, the entire frame buffer or a band of rows of it
+ * @param pixels the first pixel of the first row
+ * @param width the number of pixels per row, the width of the screen
+ * @param top the row of the screen the pixels start at
+ * @param rows the number of rows in the pixels
+*/
+struct Widget_Canvas
+{
+    unsigned short* pixels;
+    unsigned int width;
+    unsigned int top;
+    unsigned int rows;
+};
+
+/**
+ * @brief Called between the widgets while a tree is drawn, to let more urgent work run
+ * @param context whatever was passed along with the hook
+*/
+typedef void (*Widget_Yield)(void* context);
+
+class Widget
+{
+public:
+    Widget(Screen_Rect bounds = {0, 0, 0, 0});
+
+    bool add(Widget* child);
+    void setBounds(Screen_Rect bounds);
+    Screen_Rect getBounds();
+    void setVisible(bool visible);
+    bool isVisible();
+    bool isShown();
+
+    void invalidate();
+    bool isDirty();
+
+    bool render(Widget_Canvas canvas, Background* background, Screen* screen);
+    bool collect(Screen_Rect* area);
+    void paint(Widget_Canvas canvas);
+    static void layer(unsigned short* band, Screen_Rect area, void* context);
+
+    static void fill(Widget_Canvas canvas, Screen_Rect rect, unsigned short color);
+    static void setYield(Widget_Yield yield, void* context = nullptr);
+protected:
+    Screen_Rect bounds;
+    Widget* parent = nullptr;
+    Widget* children[WIDGET_MAX_CHILDREN];
+    unsigned int childCount = 0;
+    bool visible = true;
+    bool dirty = true;
+
+    virtual void draw(Widget_Canvas canvas);
+    virtual void update();
+    virtual void shown(bool visible);
+    virtual bool isOpaque();
+    virtual void erase(Widget_Canvas canvas, Screen_Rect rect, Background* background);
+private:
+    bool render(Widget_Canvas canvas, Background* background, Screen* screen, bool covered);
+    void notify(bool visible);
+    static bool overlaps(Screen_Rect a, Screen_Rect b);
+
+    static Widget_Yield yieldFunction;
+    static void* yieldContext;
+};
@@ -0,0 +1,78 @@
+#include "Bar.hpp"
+
+/**
+ * @brief Construct a new Bar:: Bar object
+ * @param color the color of the filled part, in RGB565
+ * @param track the color of the rest, in RGB565
+ * @param bounds the area of the screen the bar covers, it fills from left to right
+*/
+Bar::Bar(unsigned short color, unsigned short track, Screen_Rect bounds) : Widget(bounds)
+{
+    this->color = color;
+    this->track = track;
+}
+
+/**
+ * @brief Set the value of a full bar
+ * @param maximum the value, anything above it shows as full
+*/
+void Bar::setRange(int maximum)
+{
+    this->maximum = MAX(maximum, 1);
+    this->fit();
+}
+
+/**
+ * @brief Change the value
+ * @param value the value, anything below 0 shows as empty
+ * @note The bar is only drawn again if the filled part changed by at least a pixel
+*/
+void Bar::setValue(int value)
+{
+    this->value = value;
+    this->fit();
+}
+
+/**
+ * @brief Get the value
+ * @return the value
+*/
+int Bar::getValue()
+{
+    return this->value;
+}
+
+/**
+ * @brief Draw the filled part and the track
+ * @param canvas the pixels to draw into
+*/
+void Bar::draw(Widget_Canvas canvas)
+{
+    unsigned int filled = MIN(this->filled, this->bounds.width);
+    this->fill(canvas, {this->bounds.x, this->bounds.y, filled, this->bounds.height}, this->color);
+    this->fill(canvas, {this->bounds.x + filled, this->bounds.y, this->bounds.width - filled, this->bounds.height}, this->track);
+}
+
+/**
+ * @brief The bar fills its entire bounds
+ * @return true
+*/
+bool Bar::isOpaque()
+{
+    return true;
+}
+
+/**
+ * @private
+ * @brief Work out how many pixels are filled, and mark the bar as changed if that differs from before
+*/
+void Bar::fit()
+{
+    int value = MIN(MAX(this->value, 0), this->maximum);
+    unsigned int filled = (long long)value * this->bounds.width / this->maximum;
+    if(filled == this->filled)
+        return;
+
+    this->filled = filled;
+    this->invalidate();
+}
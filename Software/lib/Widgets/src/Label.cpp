@@ -0,0 +1,86 @@
+#include "Label.hpp"
+
+/**
+ * @brief Construct a new Label:: Label object
+ * @param font draws the text, so the label works with whatever does the text rendering
+ * @param context passed along to the font
+ * @param bounds the area of the screen the label covers, the text is drawn from its top left corner
+*/
+Label::Label(Label_Font font, void* context, Screen_Rect bounds) : Widget(bounds)
+{
+    this->font = font;
+    this->context = context;
+}
+
+/**
+ * @brief Change the text, the label is only drawn again if it is different
+ * @param text the text, cut off at LABEL_MAX_LENGTH - 1 characters
+*/
+void Label::setText(const char* text)
+{
+    if(strncmp(text, this->text, LABEL_MAX_LENGTH - 1) == 0)
+        return;
+    strncpy(this->text, text, LABEL_MAX_LENGTH - 1);
+    this->invalidate();
+}
+
+/**
+ * @brief Get the text of the label
+ * @return the text
+*/
+const char* Label::getText()
+{
+    return this->text;
+}
+
+/**
+ * @brief Change the color of the text
+ * @param color the color, in whatever format the font takes
+*/
+void Label::setColor(unsigned int color)
+{
+    if(color == this->color)
+        return;
+    this->color = color;
+    this->invalidate();
+}
+
+/**
+ * @brief Get the color of the text
+ * @return the color
+*/
+unsigned int Label::getColor()
+{
+    return this->color;
+}
+
+/**
+ * @brief Center the text horizontally within the bounds
+ * @param centered true to center it, false to start at the left edge
+*/
+void Label::setCentered(bool centered)
+{
+    if(centered == this->centered)
+        return;
+    this->centered = centered;
+    this->invalidate();
+}
+
+/**
+ * @brief Check if the text is centered
+ * @return true if it is
+*/
+bool Label::isCentered()
+{
+    return this->centered;
+}
+
+/**
+ * @brief Draw the text through the font
+ * @param canvas the pixels to draw into
+*/
+void Label::draw(Widget_Canvas canvas)
+{
+    if(this->text[0] != '\0')
+        this->font(this, canvas, this->context);
+}
@@ -0,0 +1,96 @@
+#include "Pager.hpp"
+
+/**
+ * @brief Construct a new Pager:: Pager object
+ * @param root the widget the pages are added to, it should cover the entire screen
+*/
+Pager::Pager(Widget* root)
+{
+    this->root = root;
+}
+
+/**
+ * @brief Add a page
+ * @param page the widget holding the page
+ * @param update hands the latest values to the widgets of the page, only called while it is shown
+ * @param context passed along to the update
+ * @return true if the page was added
+ * @note Only the first page starts out shown. Add the page before filling it, so its widgets are
+ * not told they disappeared before they were ever shown.
+*/
+bool Pager::add(Widget* page, Pager_Update update, void* context)
+{
+    if(this->count >= PAGER_MAX_PAGES)
+        return false;
+
+    if(this->count > 0)
+        page->setVisible(false);
+    if(!this->root->add(page))
+        return false;
+
+    this->pages[this->count] = {page, update, context};
+    this->count++;
+    return true;
+}
+
+/**
+ * @brief Switch to a page
+ * @param index the index of the page, in the order they were added
+ * @note The old page is hidden, which draws the root again from the background, and the new one
+ * is drawn on top of it with the next render
+*/
+void Pager::show(unsigned int index)
+{
+    if(index >= this->count || index == this->current)
+        return;
+
+    this->pages[this->current].page->setVisible(false);
+    this->current = index;
+    this->pages[this->current].page->setVisible(true);
+}
+
+/**
+ * @brief Switch to the next page, wrapping around after the last one
+*/
+void Pager::next()
+{
+    if(this->count > 0)
+        this->show((this->current + 1) % this->count);
+}
+
+/**
+ * @brief Switch to the previous page, wrapping around before the first one
+*/
+void Pager::previous()
+{
+    if(this->count > 0)
+        this->show((this->current + this->count - 1) % this->count);
+}
+
+/**
+ * @brief Keep the page that is shown up to date
+ * @note The hidden pages are neither updated nor rendered, so they take no time at all
+*/
+void Pager::update()
+{
+    if(this->current < this->count && this->pages[this->current].update != nullptr)
+        this->pages[this->current].update(this->pages[this->current].context);
+}
+
+/**
+ * @brief Get the page that is shown
+ * @return the index of the page
+*/
+unsigned int Pager::getCurrent()
+{
+    return this->current;
+}
+
+/**
+ * @brief Get the number of pages
+ * @return the number of pages
+*/
+unsigned int Pager::getCount()
+{
+    return this->count;
+}
@@ -0,0 +1,53 @@
+#include "Panel.hpp"
+
+/**
+ * @brief Construct a new Panel:: Panel object
+ * @param color the color the panel is filled with, in RGB565
+ * @param bounds the area of the screen the panel covers
+ * @note The panel hides the background, its children are drawn on top of the color
+*/
+Panel::Panel(unsigned short color, Screen_Rect bounds) : Widget(bounds)
+{
+    this->color = color;
+}
+
+/**
+ * @brief Change the color of the panel
+ * @param color the color in RGB565
+*/
+void Panel::setColor(unsigned short color)
+{
+    if(color == this->color)
+        return;
+    this->color = color;
+    this->invalidate();
+}
+
+/**
+ * @brief Fill the panel
+ * @param canvas the pixels to draw into
+*/
+void Panel::draw(Widget_Canvas canvas)
+{
+    this->fill(canvas, this->bounds, this->color);
+}
+
+/**
+ * @brief The panel fills its entire bounds
+ * @return true
+*/
+bool Panel::isOpaque()
+{
+    return true;
+}
+
+/**
+ * @brief Fill the area behind a child with the color of the panel
+ * @param canvas the pixels to draw into
+ * @param rect the area
+ * @param background unused, the panel covers it
+*/
+void Panel::erase(Widget_Canvas canvas, Screen_Rect rect, Background* background)
+{
+    this->fill(canvas, rect, this->color);
+}
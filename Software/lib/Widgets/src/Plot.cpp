@@ -0,0 +1,51 @@
+#include "Plot.hpp"
+
+/**
+ * @brief Construct a new Plot:: Plot object
+ * @param graph the graph shown in the plot
+ * @param bounds the area of the screen the graph covers
+ * @note The graph draws into the frame buffer and marks its own columns, so the plot only tells it
+ * when to show up and when to draw everything again
+*/
+Plot::Plot(Graph* graph, Screen_Rect bounds) : Widget(bounds)
+{
+    this->graph = graph;
+}
+
+/**
+ * @brief Have the graph draw all of its columns with the next update
+ * @param canvas unused, the graph draws into the frame buffer
+*/
+void Plot::draw(Widget_Canvas canvas)
+{
+    this->graph->redraw();
+}
+
+/**
+ * @brief Draw the new columns of the graph
+*/
+void Plot::update()
+{
+    this->graph->render();
+}
+
+/**
+ * @brief Show or hide the graph along with the plot, the graph takes over the scrolling of the display
+ * @param visible true if the plot appeared
+*/
+void Plot::shown(bool visible)
+{
+    if(visible)
+        this->graph->show();
+    else
+        this->graph->hide();
+}
+
+/**
+ * @brief The graph covers its entire bounds
+ * @return true
+*/
+bool Plot::isOpaque()
+{
+    return true;
+}
@@ -0,0 +1,70 @@
+#include "Readout.hpp"
+
+/**
+ * @brief Construct a new Readout:: Readout object
+ * @param glyphs the glyph cache the digits are drawn from
+ * @param formatter turns the value into text
+ * @param unit the unit of the value
+ * @param color the color of the text in RGB565
+ * @param bounds the area of the screen the readout covers, the text is centered in it
+*/
+Readout::Readout(GlyphCache* glyphs, Formatter* formatter, char unit, unsigned short color, Screen_Rect bounds) : Widget(bounds)
+{
+    this->glyphs = glyphs;
+    this->formatter = formatter;
+    this->unit = unit;
+    this->color = color;
+}
+
+/**
+ * @brief Change the value
+ * @param value the value in micro units
+ * @note The readout is only drawn again if the text changed, values closer together than the
+ * digits shown look the same
+*/
+void Readout::setValue(int value)
+{
+    if(this->formatted && value == this->value)
+        return;
+    this->value = value;
+    this->formatted = true;
+
+    char text[READOUT_MAX_LENGTH];
+    this->formatter->format(text, READOUT_MAX_LENGTH, value, this->unit);
+    if(strcmp(text, this->text) == 0)
+        return;
+
+    strcpy(this->text, text);
+    this->invalidate();
+}
+
+/**
+ * @brief Get the value
+ * @return the value in micro units
+*/
+int Readout::getValue()
+{
+    return this->value;
+}
+
+/**
+ * @brief Get the text shown for the value
+ * @return the text
+*/
+const char* Readout::getText()
+{
+    return this->text;
+}
+
+/**
+ * @brief Draw the text from the glyph cache
+ * @param canvas the pixels to draw into
+*/
+void Readout::draw(Widget_Canvas canvas)
+{
+    unsigned int width = MIN(this->glyphs->measure(this->text), this->bounds.width);
+
+    this->glyphs->setTarget(canvas.pixels, canvas.top, canvas.rows);
+    this->glyphs->draw(this->text, this->bounds.x + (this->bounds.width - width) / 2, this->bounds.y, this->color);
+    this->glyphs->resetTarget();
+}
@@ -0,0 +1,366 @@
+#include "Widget.hpp"
+
+Widget_Yield Widget::yieldFunction = nullptr;
+void* Widget::yieldContext = nullptr;
+
+/**
+ * @brief Construct a new Widget:: Widget object
+ * @param bounds the area of the screen the widget covers
+ * @note A plain widget draws nothing itself, it is a transparent container for its children
+*/
+Widget::Widget(Screen_Rect bounds)
+{
+    this->bounds = bounds;
+}
+
+/**
+ * @brief Add a child to the widget
+ * @param child the child, drawn on top of the widget and of the children added before it
+ * @return true if the child was added
+ * @note The children have to lie within the bounds of the widget
+*/
+bool Widget::add(Widget* child)
+{
+    if(this->childCount >= WIDGET_MAX_CHILDREN)
+        return false;
+
+    child->parent = this;
+    child->dirty = true;
+    this->children[this->childCount++] = child;
+    return true;
+}
+
+/**
+ * @brief Move or resize the widget
+ * @param bounds the area of the screen the widget covers
+ * @note Both the old and the new area are drawn again
+*/
+void Widget::setBounds(Screen_Rect bounds)
+{
+    if(this->parent != nullptr && this->visible)
+        this->parent->invalidate();
+    this->bounds = bounds;
+    this->dirty = true;
+}
+
+/**
+ * @brief Get the area of the screen the widget covers
+ * @return the bounds of the widget
+*/
+Screen_Rect Widget::getBounds()
+{
+    return this->bounds;
+}
+
+/**
+ * @brief Show or hide the widget and its children
+ * @param visible true to show the widget
+ * @note Hiding a widget draws its parent again, to get rid of it. Hidden widgets are skipped entirely.
+*/
+void Widget::setVisible(bool visible)
+{
+    if(visible == this->visible)
+        return;
+
+    this->visible = visible;
+    if(visible)
+        this->dirty = true;
+    else if(this->parent != nullptr)
+        this->parent->invalidate();
+
+    // only tell the widgets that actually appear or disappear from the screen
+    if(this->parent == nullptr || this->parent->isShown())
+        this->notify(visible);
+}
+
+/**
+ * @brief Check if the widget is set to be visible
+ * @return true if it is, even if one of its parents is hidden
+*/
+bool Widget::isVisible()
+{
+    return this->visible;
+}
+
+/**
+ * @brief Check if the widget is actually on the screen
+ * @return true if the widget and all of its parents are visible
+*/
+bool Widget::isShown()
+{
+    return this->visible && (this->parent == nullptr || this->parent->isShown());
+}
+
+/**
+ * @brief Mark the widget as changed, so it is drawn again with the next render
+*/
+void Widget::invalidate()
+{
+    this->dirty = true;
+}
+
+/**
+ * @brief Check if anything that is shown has to be drawn again
+ * @return true if the widget or one of its visible children changed
+*/
+bool Widget::isDirty()
+{
+    if(!this->visible)
+        return false;
+    if(this->dirty)
+        return true;
+
+    for(unsigned int i = 0; i < this->childCount; i++)
+        if(this->children[i]->isDirty())
+            return true;
+    return false;
+}
+
+/**
+ * @brief Draw the widgets that changed into the frame buffer, and mark their bounds on the screen
+ * @param canvas the frame buffer
+ * @param background where the transparent widgets get what is behind them from
+ * @param screen the screen the changed areas are marked on
+ * @return true if anything was drawn
+*/
+bool Widget::render(Widget_Canvas canvas, Background* background, Screen* screen)
+{
+    return this->render(canvas, background, screen, false);
+}
+
+/**
+ * @brief Gather the area covered by the widgets that changed, for renderers that draw everything in it
+ * @param area the area, grown to cover the changed widgets. Empty to start with.
+ * @return true if anything changed
+ * @note The widgets are marked as drawn, so the area has to be painted afterwards
+*/
+bool Widget::collect(Screen_Rect* area)
+{
+    if(!this->visible)
+        return false;
+
+    bool changed = false;
+    if(this->dirty)
+    {
+        if(area->width == 0 || area->height == 0)
+            *area = this->bounds;
+        else
+        {
+            unsigned int right = MAX(area->x + area->width, this->bounds.x + this->bounds.width);
+            unsigned int bottom = MAX(area->y + area->height, this->bounds.y + this->bounds.height);
+            area->x = MIN(area->x, this->bounds.x);
+            area->y = MIN(area->y, this->bounds.y);
+            area->width = right - area->x;
+            area->height = bottom - area->y;
+        }
+        this->dirty = false;
+        changed = true;
+    }
+
+    for(unsigned int i = 0; i < this->childCount; i++)
+        changed |= this->children[i]->collect(area);
+    return changed;
+}
+
+/**
+ * @brief Draw the widget and its children as far as they fall on the canvas, changed or not
+ * @param canvas the pixels to draw into, with the background already in them
+*/
+void Widget::paint(Widget_Canvas canvas)
+{
+    if(!this->visible)
+        return;
+
+    if(this->bounds.y < canvas.top + canvas.rows && this->bounds.y + this->bounds.height > canvas.top)
+    {
+        this->draw(canvas);
+        if(yieldFunction != nullptr)
+            yieldFunction(yieldContext);
+    }
+
+    for(unsigned int i = 0; i < this->childCount; i++)
+        this->children[i]->paint(canvas);
+}
+
+/**
+ * @brief Strip layer, paints the widget tree into the band
+ * @param band the pixels of the band
+ * @param area the area of the screen the band covers
+ * @param context the root of the tree
+*/
+void Widget::layer(unsigned short* band, Screen_Rect area, void* context)
+{
+    ((Widget*)context)->paint({band, area.width, area.y, area.height});
+}
+
+/**
+ * @brief Fill an area of the canvas with a single color
+ * @param canvas the pixels to draw into
+ * @param rect the area of the screen
+ * @param color the color in RGB565
+*/
+void Widget::fill(Widget_Canvas canvas, Screen_Rect rect, unsigned short color)
+{
+    unsigned int top = MAX(rect.y, canvas.top);
+    unsigned int bottom = MIN(rect.y + rect.height, canvas.top + canvas.rows);
+    unsigned int right = MIN(rect.x + rect.width, canvas.width);
+    if(rect.x >= right)
+        return;
+
+    for(unsigned int y = top; y < bottom; y++)
+    {
+        unsigned short* pixels = &canvas.pixels[(y - canvas.top) * canvas.width];
+        for(unsigned int x = rect.x; x < right; x++)
+            pixels[x] = color;
+    }
+}
+
+/**
+ * @brief Draw the widget itself, the children are drawn on top of it afterwards
+ * @param canvas the pixels to draw into, the widget has to stay within its bounds and the rows of the canvas
+*/
+void Widget::draw(Widget_Canvas canvas)
+{
+}
+
+/**
+ * @brief Called with every render while the widget is shown, for widgets that draw on their own
+*/
+void Widget::update()
+{
+}
+
+/**
+ * @brief Called when the widget appears on or disappears from the screen
+ * @param visible true if it appeared
+*/
+void Widget::shown(bool visible)
+{
+}
+
+/**
+ * @brief Check if the widget covers its entire bounds when it draws
+ * @return true if nothing behind it has to be restored first
+*/
+bool Widget::isOpaque()
+{
+    return false;
+}
+
+/**
+ * @brief Draw what is behind the children in an area
+ * @param canvas the pixels to draw into
+ * @param rect the area
+ * @param background the background behind the whole tree
+ * @note A transparent widget leaves it to its parent, the root restores the background
+*/
+void Widget::erase(Widget_Canvas canvas, Screen_Rect rect, Background* background)
+{
+    if(this->parent != nullptr)
+        this->parent->erase(canvas, rect, background);
+    else
+        background->restore(rect);
+}
+
+/**
+ * @private
+ * @brief Draw the widget if it changed, then its children
+ * @param canvas the frame buffer
+ * @param background where the transparent widgets get what is behind them from
+ * @param screen the screen the changed areas are marked on
+ * @param covered true if a parent was just drawn, so there is nothing to erase or mark
+ * @return true if anything was drawn
+*/
+bool Widget::render(Widget_Canvas canvas, Background* background, Screen* screen, bool covered)
+{
+    if(!this->visible)
+        return false;
+
+    bool drawn = false;
+    if(this->dirty || covered)
+    {
+        if(!covered)
+        {
+            if(!this->isOpaque())
+            {
+                if(this->parent != nullptr)
+                    this->parent->erase(canvas, this->bounds, background);
+                else
+                    background->restore(this->bounds);
+            }
+            screen->invalidate(this->bounds);
+        }
+        this->draw(canvas);
+        this->dirty = false;
+        drawn = true;
+
+        // the widget is done, a good moment for whatever can not wait for the rest of the tree
+        if(yieldFunction != nullptr)
+            yieldFunction(yieldContext);
+    }
+    this->update();
+
+    // erasing a child wipes whatever of its siblings overlaps it, so those are drawn again as well
+    for(unsigned int i = 0; i < this->childCount && !drawn; i++)
+    {
+        Widget* child = this->children[i];
+        if(!child->visible || !child->dirty || child->isOpaque())
+            continue;
+        for(unsigned int j = 0; j < this->childCount; j++)
+            if(j != i && this->children[j]->visible && this->overlaps(child->bounds, this->children[j]->bounds))
+                this->children[j]->dirty = true;
+    }
+
+    // the children of a widget that was just drawn are drawn along with it
+    bool redrawn = drawn;
+    for(unsigned int i = 0; i < this->childCount; i++)
+    {
+        Widget* child = this->children[i];
+        if(!child->render(canvas, background, screen, redrawn))
+            continue;
+        drawn = true;
+
+        // whatever was drawn may have ended up under an opaque sibling on top of it, that has to cover it again
+        for(unsigned int j = i + 1; j < this->childCount && !redrawn; j++)
+            if(this->children[j]->visible && this->children[j]->isOpaque() && this->overlaps(child->bounds, this->children[j]->bounds))
+                this->children[j]->dirty = true;
+    }
+    return drawn;
+}
+
+/**
+ * @brief Set the function that is called after every widget that is drawn
+ * @param yield the function, or nullptr to stop calling it
+ * @param context passed along to the function
+ * @note The function must not touch the widgets or the canvas they are drawn into
+*/
+void Widget::setYield(Widget_Yield yield, void* context)
+{
+    yieldFunction = yield;
+    yieldContext = context;
+}
+
+/**
+ * @private
+ * @brief Tell the widget and its visible children that they appeared or disappeared
+ * @param visible true if they appeared
+*/
+void Widget::notify(bool visible)
+{
+    this->shown(visible);
+    for(unsigned int i = 0; i < this->childCount; i++)
+        if(this->children[i]->visible)
+            this->children[i]->notify(visible);
+}
+
+/**
+ * @private
+ * @brief Check if two areas overlap
+ * @param a the one area
+ * @param b the other area
+ * @return true if they share at least one pixel
+*/
+bool Widget::overlaps(Screen_Rect a, Screen_Rect b)
+{
+    return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
@@ -0,0 +1,159 @@
+# Build time asset pipeline, called by the functions in cmake/Assets.cmake
+#
+# Every asset is turned into three files in the output directory:
+#   <name>.bin  the blob itself
+#   <name>.S    pulls the blob into flash through .incbin, aligned to a word
+#   <name>.h    the metadata and the declaration of the blob, small enough to include anywhere
+#
+# Usage:
+#   python3 assets.py image input.png output_dir name [--raw] [--size WIDTHxHEIGHT]
+#   python3 assets.py font input.ttf output_dir name --pixels 48 [--charset "0123456789"]
+#
+# Fonts are subset to the charset, printable ASCII by default, and packed in the order of the charset.
+#
+# The header is only rewritten when its content changes, so changing the pixels of an image
+# only reassembles the blob instead of recompiling everything that includes the header.
+
+
+import argparse
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "image_converter"))
+import converter
+
+
+FONT_MAGIC = 0x38544e46     # "FNT8"
+FONT_DEFAULT_CHARSET = "".join(chr(character) for character in range(0x20, 0x7f))
+
+
+def write_if_changed(path, content):
+    mode = "wb" if isinstance(content, bytes) else "w"
+    if os.path.exists(path):
+        with open(path, "rb" if mode == "wb" else "r") as file:
+            if file.read() == content:
+                return
+    with open(path, mode) as file:
+        file.write(content)
+
+
+def write_asset(output, name, blob, source, metadata):
+    binary = os.path.join(output, name + ".bin")
+    write_if_changed(binary, bytes(blob))
+
+    write_if_changed(os.path.join(output, name + ".S"),
+        "// Generated by scripts/asset_pipeline/assets.py from %s, do not edit\n"
+        ".section .rodata.%s, \"a\"\n"
+        ".global %s\n"
+        ".type %s, %%object\n"
+        ".balign 4\n"
+        "%s:\n"
+        ".incbin \"%s\"\n"
+        ".size %s, .-%s\n"
+        % (os.path.basename(source), name, name, name, name, binary.replace("\\", "/"), name, name))
+
+    guard = name.upper()
+    header = "#pragma once\n"
+    header += "// Generated by scripts/asset_pipeline/assets.py from %s, do not edit\n" % os.path.basename(source)
+    for key, value in metadata:
+        header += "#define %s_%s %s\n" % (guard, key, value)
+    header += "const unsigned int %s_size = %d;\n" % (name, len(blob))
+    header += "extern \"C\" const unsigned char %s[];" % name
+    write_if_changed(os.path.join(output, name + ".h"), header)
+
+
+def convert_image(args):
+    extension = os.path.splitext(args.input)[1].lower()
+    size = tuple(int(value) for value in args.size.lower().split("x")) if args.size else None
+    if extension == ".png":
+        pixels, width, height = converter.load_png(args.input)
+    elif extension in (".h", ".c"):
+        pixels, width, height = converter.load_gimp(args.input, size)
+    else:
+        with open(args.input, "rb") as file:
+            pixels, width, height = converter.load_raw(file.read(), size)
+
+    # raw pixels are faster to draw, compressed ones take a fraction of the flash
+    if args.raw:
+        blob = struct.pack("<%dH" % len(pixels), *pixels)
+    else:
+        blob = converter.encode(pixels, width, height)
+
+    write_asset(args.output, args.name, blob, args.input, [
+        ("WIDTH", width),
+        ("HEIGHT", height),
+        ("COMPRESSED", 0 if args.raw else 1),
+    ])
+
+
+def convert_font(args):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        print("The 'Pillow' module is not installed, it is needed to rasterize fonts")
+        sys.exit(1)
+
+    font = ImageFont.truetype(args.input, args.pixels)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+
+    # subset the font to the characters given, once each and in the order given, which should be the order
+    # they are drawn in most, so the glyphs that are used together end up next to each other in flash
+    charset = "".join(dict.fromkeys(args.charset))
+
+    # every glyph is as wide as its advance, only the rows between the first and last one with ink are kept
+    glyphs = []
+    coverage = bytearray()
+    for character in charset:
+        width = int(round(font.getlength(character)))
+        cell = Image.new("L", (max(width, 1), height), 0)
+        ImageDraw.Draw(cell).text((0, 0), character, font=font, fill=255)
+        pixels = cell.tobytes()[:width * height]
+
+        rows = [row for row in range(height) if width > 0 and any(pixels[row * width:(row + 1) * width])]
+        top = rows[0] if rows else 0
+        bottom = rows[-1] + 1 if rows else 0
+        glyphs.append((ord(character), width, top, bottom - top, len(coverage)))
+        coverage += pixels[top * width:bottom * width]
+
+    blob = struct.pack("<IHH", FONT_MAGIC, height, len(glyphs))
+    for character, width, top, rows, offset in glyphs:
+        blob += struct.pack("<BBBBI", character, width, top, rows, offset)
+    blob += coverage
+
+    write_asset(args.output, args.name, blob, args.input, [
+        ("HEIGHT", height),
+        ("GLYPHS", len(glyphs)),
+    ])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert assets into blobs for the firmware")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    image = commands.add_parser("image", help="convert an image to RGB565")
+    image.add_argument("input", help="PNG, GIMP RGB565 C source dump or raw RGB565 file")
+    image.add_argument("output", help="the directory to write the asset to")
+    image.add_argument("name", help="the name of the asset")
+    image.add_argument("--size", help="WIDTHxHEIGHT, needed for C source dumps and raw files")
+    image.add_argument("--raw", action="store_true", help="store the pixels uncompressed")
+
+    font = commands.add_parser("font", help="rasterize a font into coverage cells")
+    font.add_argument("input", help="TTF or OTF file")
+    font.add_argument("output", help="the directory to write the asset to")
+    font.add_argument("name", help="the name of the asset")
+    font.add_argument("--pixels", type=int, required=True, help="the size of the font in pixels")
+    font.add_argument("--charset", default=FONT_DEFAULT_CHARSET,
+        help="the characters to include, in the order they are drawn in most")
+
+    args = parser.parse_args()
+    os.makedirs(args.output, exist_ok=True)
+    if args.command == "image":
+        convert_image(args)
+    else:
+        convert_font(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,232 @@
+# Converts images into the compressed RGB565 format read by the Image library
+#
+# Usage:
+#   python3 converter.py input.png output.h name                 (8 bit gray, RGB or RGBA)
+#   python3 converter.py input.h output.h name --size 320x172     (GIMP RGB565 C source dump)
+#   python3 converter.py input.bin output.h name --size 320x172   (raw little endian RGB565)
+#
+# The format works like QOI, but on RGB565 pixels. The image is split into bands of rows that can be
+# decoded on their own, so a single area can be redrawn without decoding everything above it.
+
+
+import argparse
+import ast
+import os
+import re
+import struct
+import sys
+import zlib
+
+
+MAGIC = 0x35363551          # "Q565"
+BAND_HEIGHT = 8             # rows per band
+
+OP_INDEX = 0x00             # 00xxxxxx, index into the table of recently seen colors
+OP_DIFF = 0x40              # 01rrggbb, small difference to the previous pixel
+OP_LUMA = 0x80              # 10gggggg rrrrbbbb, green difference with red and blue relative to it
+OP_RUN = 0xc0               # 11xxxxxx, repeat the previous pixel 1 through 62 times
+OP_RGB = 0xfe               # followed by the pixel, little endian
+
+
+def split(pixel):
+    return (pixel >> 11) & 0x1f, (pixel >> 5) & 0x3f, pixel & 0x1f
+
+
+def hash_pixel(pixel):
+    r, g, b = split(pixel)
+    return (r * 3 + g * 5 + b * 7) & 0x3f
+
+
+def wrap(value, bits):
+    # wrap a difference into the signed range of the channel
+    value &= (1 << bits) - 1
+    return value - (1 << bits) if value >= (1 << (bits - 1)) else value
+
+
+def encode_band(pixels):
+    data = bytearray()
+    table = [0] * 64
+    previous = 0
+    run = 0
+
+    for pixel in pixels:
+        if pixel == previous:
+            run += 1
+            if run == 62:
+                data.append(OP_RUN | (run - 1))
+                run = 0
+            continue
+
+        if run > 0:
+            data.append(OP_RUN | (run - 1))
+            run = 0
+
+        index = hash_pixel(pixel)
+        if table[index] == pixel:
+            data.append(OP_INDEX | index)
+        else:
+            table[index] = pixel
+            r, g, b = split(pixel)
+            pr, pg, pb = split(previous)
+            dr, dg, db = wrap(r - pr, 5), wrap(g - pg, 6), wrap(b - pb, 5)
+            dr_dg, db_dg = wrap(dr - (dg >> 1), 5), wrap(db - (dg >> 1), 5)
+
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                data.append(OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                data.append(OP_LUMA | (dg + 32))
+                data.append(((dr_dg + 8) << 4) | (db_dg + 8))
+            else:
+                data.append(OP_RGB)
+                data += struct.pack("<H", pixel)
+
+        previous = pixel
+
+    if run > 0:
+        data.append(OP_RUN | (run - 1))
+
+    return data
+
+
+def encode(pixels, width, height):
+    band_count = (height + BAND_HEIGHT - 1) // BAND_HEIGHT
+    offsets = []
+    data = bytearray()
+
+    for band in range(band_count):
+        offsets.append(len(data))
+        start = band * BAND_HEIGHT * width
+        end = min(height, (band + 1) * BAND_HEIGHT) * width
+        data += encode_band(pixels[start:end])
+
+    header = struct.pack("<IHHHHI", MAGIC, width, height, BAND_HEIGHT, band_count, len(data))
+    header += struct.pack("<%dI" % band_count, *offsets)
+    return header + data
+
+
+def unfilter(data, width, height, channels):
+    # undo the per row PNG filters, only 8 bit samples are supported
+    stride = width * channels
+    rows = []
+    previous = bytearray(stride)
+    position = 0
+    for _ in range(height):
+        kind = data[position]
+        row = bytearray(data[position + 1:position + 1 + stride])
+        position += 1 + stride
+        for i in range(stride):
+            left = row[i - channels] if i >= channels else 0
+            up = previous[i]
+            corner = previous[i - channels] if i >= channels else 0
+            if kind == 1:
+                row[i] = (row[i] + left) & 0xff
+            elif kind == 2:
+                row[i] = (row[i] + up) & 0xff
+            elif kind == 3:
+                row[i] = (row[i] + ((left + up) >> 1)) & 0xff
+            elif kind == 4:
+                estimate = left + up - corner
+                distances = (abs(estimate - left), abs(estimate - up), abs(estimate - corner))
+                predictor = left if distances[0] <= distances[1] and distances[0] <= distances[2] else \
+                    up if distances[1] <= distances[2] else corner
+                row[i] = (row[i] + predictor) & 0xff
+        rows.append(row)
+        previous = row
+    return rows
+
+
+def load_png(path):
+    # plain 8 bit gray, RGB and RGBA PNG files are read without any dependencies
+    with open(path, "rb") as file:
+        data = file.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        print("%s is not a PNG file" % path)
+        sys.exit(1)
+
+    position = 8
+    compressed = b""
+    while position < len(data):
+        length, kind = struct.unpack(">I4s", data[position:position + 8])
+        body = data[position + 8:position + 8 + length]
+        position += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"IDAT":
+            compressed += body
+
+    channels = {0: 1, 2: 3, 4: 2, 6: 4}.get(color)
+    if depth != 8 or interlace != 0 or channels is None:
+        print("Only 8 bit, non interlaced gray, RGB and RGBA PNG files are supported")
+        sys.exit(1)
+
+    pixels = []
+    for row in unfilter(zlib.decompress(compressed), width, height, channels):
+        for x in range(width):
+            if channels < 3:
+                r = g = b = row[x * channels]
+            else:
+                r, g, b = row[x * channels:x * channels + 3]
+            pixels.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return pixels, width, height
+
+
+def load_raw(data, size):
+    width, height = size
+    if len(data) < width * height * 2:
+        print("Expected %d bytes, got %d" % (width * height * 2, len(data)))
+        sys.exit(1)
+    pixels = list(struct.unpack("<%dH" % (width * height), data[:width * height * 2]))
+    return pixels, width, height
+
+
+def load_gimp(path, size):
+    # glue the string literals back together and let python deal with the octal escapes
+    with open(path, "r") as file:
+        source = file.read()
+    literals = re.findall(r'"((?:[^"\\]|\\.)*)"', source)
+    data = b"".join(ast.literal_eval('b"' + literal + '"') for literal in literals)
+    return load_raw(data, size)
+
+
+def write_header(path, name, encoded, width, height):
+    with open(path, "w") as file:
+        file.write("#pragma once\n")
+        file.write("// Generated by scripts/image_converter/converter.py, %dx%d, %d bytes (%d raw)\n"
+            % (width, height, len(encoded), width * height * 2))
+        file.write("const unsigned int %s_size = %d;\n" % (name, len(encoded)))
+        file.write("const unsigned char %s[] __attribute__((aligned(4))) = {\n" % name)
+        for offset in range(0, len(encoded), 16):
+            file.write(", ".join("0x%02x" % byte for byte in encoded[offset:offset + 16]) + ",\n")
+        file.write("};")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert an image to the compressed RGB565 format")
+    parser.add_argument("input", help="PNG, GIMP RGB565 C source dump or raw RGB565 file")
+    parser.add_argument("output", help="the header to write")
+    parser.add_argument("name", help="the name of the array in the header")
+    parser.add_argument("--size", help="WIDTHxHEIGHT, needed for C source dumps and raw files")
+    args = parser.parse_args()
+
+    extension = os.path.splitext(args.input)[1].lower()
+    size = tuple(int(value) for value in args.size.lower().split("x")) if args.size else None
+    if extension != ".png" and size is None:
+        print("--size is needed for anything but PNG files")
+        sys.exit(1)
+
+    if extension == ".png":
+        pixels, width, height = load_png(args.input)
+    elif extension in (".h", ".c"):
+        pixels, width, height = load_gimp(args.input, size)
+    else:
+        with open(args.input, "rb") as file:
+            pixels, width, height = load_raw(file.read(), size)
+
+    encoded = encode(pixels, width, height)
+    write_header(args.output, args.name, encoded, width, height)
+    print("%s: %dx%d, %d bytes raw, %d bytes compressed (%.1f%%)"
+        % (args.output, width, height, width * height * 2, len(encoded), 100 * len(encoded) / (width * height * 2)))
+
+
+if __name__ == "__main__":
+    main()
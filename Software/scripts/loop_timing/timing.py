@@ -0,0 +1,126 @@
+# Loop timing capture, reads Device_Loop_Timing over USB
+#
+# Prints the min, avg and max cycles of every stage of the main loops, and optionally saves them.
+# Given two saved captures, prints them side by side with the change of every value, which is how
+# the HOT_RAM placement is compared against the default one.
+#
+# Usage:
+#   python3 timing.py [--port COM3] [--save capture.json]
+#   python3 timing.py --compare flash.json sram.json
+
+
+# the vendor id of the device
+vendor_id = "2E8A"
+product_id = "000A"
+# baudrate
+baudrate = 9600
+timeout = 1
+# the address of Device_Loop_Timing
+loop_timing_address = 0x01
+
+
+import argparse
+import json
+import subprocess
+import sys
+
+
+# check if the 'pyserial' module is installed and install it if not
+try:
+    import serial
+    import serial.tools.list_ports
+except ImportError:
+    print("The 'pyserial' module is not installed. Installing now...")
+    subprocess.call([sys.executable, "-m", "pip", "install", "pyserial"])
+    import serial
+    import serial.tools.list_ports
+
+
+# same order as the STAGE_ defines in main.h
+STAGES = ["sampling", "usb", "registers", "buttons", "background", "text", "display", "other"]
+STAGE_LOOPS = 24
+STAGE_OVERHEAD = 25
+STAGE_PLACEMENT = 26
+STAGE_UI_LOOPS = 27
+
+
+def find_port():
+    for port in serial.tools.list_ports.comports():
+        if port.vid is not None and f"{port.vid:04X}" == vendor_id and f"{port.pid:04X}" == product_id:
+            return port.device
+    return None
+
+
+def read_register(device, address, index):
+    """ 0 = read, then the address and the index, the rest of the 7 bytes is ignored """
+    device.write(bytes([0, address, index, 0, 0, 0, 0]))
+    line = device.readline().decode(errors="ignore").strip()
+    return int(line)
+
+
+def capture(port):
+    with serial.Serial(port, baudrate, timeout=timeout) as device:
+        values = [read_register(device, loop_timing_address, index) for index in range(STAGE_UI_LOOPS + 1)]
+
+    return {
+        "placement": "sram" if values[STAGE_PLACEMENT] else "flash",
+        "loops": values[STAGE_LOOPS],
+        "ui_loops": values[STAGE_UI_LOOPS],
+        "overhead": values[STAGE_OVERHEAD],
+        "stages": {name: values[i * 3:i * 3 + 3] for i, name in enumerate(STAGES)},
+    }
+
+
+def print_capture(timing):
+    print(f"placement {timing['placement']}, {timing['loops']} control loops/s, "
+          f"{timing['ui_loops']} UI loops/s, {timing['overhead']} cycles per probe")
+    print(f"{'stage':<12}{'min':>10}{'avg':>10}{'max':>10}")
+    for name in STAGES:
+        low, average, high = timing["stages"][name]
+        print(f"{name:<12}{low:>10}{average:>10}{high:>10}")
+
+
+def change(before, after):
+    if before == 0:
+        return "-"
+    return f"{(after - before) * 100 / before:+.1f}%"
+
+
+def print_comparison(before, after):
+    print(f"{before['placement']} -> {after['placement']}, "
+          f"control loops/s {before['loops']} -> {after['loops']}, "
+          f"UI loops/s {before['ui_loops']} -> {after['ui_loops']}")
+    print(f"{'stage':<12}{'':>5}{'before':>10}{'after':>10}{'change':>10}")
+    for name in STAGES:
+        for label, old, new in zip(("min", "avg", "max"), before["stages"][name], after["stages"][name]):
+            print(f"{name if label == 'min' else '':<12}{label:>5}{old:>10}{new:>10}{change(old, new):>10}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Capture or compare the loop timing of the device")
+    parser.add_argument("--port", help="serial port of the device, found by its USB id if left out")
+    parser.add_argument("--save", help="write the capture to this file")
+    parser.add_argument("--compare", nargs=2, metavar=("BEFORE", "AFTER"), help="compare two saved captures")
+    args = parser.parse_args()
+
+    if args.compare:
+        with open(args.compare[0]) as file:
+            before = json.load(file)
+        with open(args.compare[1]) as file:
+            after = json.load(file)
+        print_comparison(before, after)
+        return
+
+    port = args.port or find_port()
+    if port is None:
+        sys.exit("Device not found")
+
+    timing = capture(port)
+    print_capture(timing)
+    if args.save:
+        with open(args.save, "w") as file:
+            json.dump(timing, file, indent=4)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,121 @@
+# Placement report, called after the firmware is linked
+#
+# Lists what runs from SRAM and what sits in the scratch banks, with the totals of every region,
+# and checks that every function marked with HOT_FUNC in the sources landed in SRAM.
+# With HOT_RAM off the marked functions are all expected in flash, so they are listed as such.
+#
+# Usage:
+#   python3 placement.py firmware.elf output.txt --nm arm-none-eabi-nm --sources dir [dir ...]
+
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+
+# address ranges of the RP2040, the scratch banks sit right behind the four striped SRAM banks
+REGIONS = [
+    ("flash",     0x10000000, 0x11000000),
+    ("sram",      0x20000000, 0x20040000),
+    ("scratch_x", 0x20040000, 0x20041000),
+    ("scratch_y", 0x20041000, 0x20042000),
+]
+
+HOT_FUNC = re.compile(r"HOT_FUNC\(\s*([\w:~]+)\s*\)")
+HOT_TABLE = re.compile(r"HOT_TABLE\(\s*\"(\w+)\"\s*\)\s*(\w+)")
+
+
+def region_of(address):
+    for name, start, end in REGIONS:
+        if start <= address < end:
+            return name
+    return "other"
+
+
+def read_symbols(nm, elf):
+    """ returns (address, size, type, name) of every symbol with a size, names demangled """
+    output = subprocess.run([nm, "-S", "-C", "--defined-only", elf], check=True, capture_output=True, text=True).stdout
+    symbols = []
+    for line in output.splitlines():
+        parts = line.split(maxsplit=3)
+        if len(parts) != 4:
+            continue
+        address, size, kind, name = parts
+        symbols.append((int(address, 16), int(size, 16), kind, name))
+    return symbols
+
+
+def find_marked(directories):
+    """ returns the names of the functions and tables marked in the sources """
+    functions = set()
+    tables = set()
+    for directory in directories:
+        for root, _, files in os.walk(directory):
+            for file in files:
+                if not file.endswith((".cpp", ".c")):
+                    continue
+                with open(os.path.join(root, file), errors="ignore") as source:
+                    text = source.read()
+                functions.update(HOT_FUNC.findall(text))
+                tables.update(name for _, name in HOT_TABLE.findall(text))
+    return functions, tables
+
+
+def base_name(symbol):
+    """ strips the arguments off a demangled name, INA219::getData(bool) becomes INA219::getData """
+    return symbol.split("(", 1)[0]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Report where the code and data of the firmware landed")
+    parser.add_argument("elf")
+    parser.add_argument("output")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--sources", nargs="*", default=[])
+    args = parser.parse_args()
+
+    symbols = read_symbols(args.nm, args.elf)
+    functions, tables = find_marked(args.sources)
+
+    totals = {name: [0, 0] for name, _, _ in REGIONS}    # code and data bytes of every region
+    lines = []
+    for address, size, kind, name in sorted(symbols):
+        region = region_of(address)
+        if region == "other":
+            continue
+        code = kind in "Tt"
+        totals[region][0 if code else 1] += size
+        # flash and the striped SRAM data are the bulk of the image, only the hot parts are listed
+        if region == "flash" or (region == "sram" and not code):
+            continue
+        lines.append(f"{region:<10} 0x{address:08x} {size:6} {'code' if code else 'data'}  {name}")
+
+    # the marked functions and tables, and whether they made it out of flash
+    marked = []
+    missing = 0
+    for address, size, kind, name in sorted(symbols, key=lambda symbol: symbol[3]):
+        if base_name(name) in functions or name in tables:
+            region = region_of(address)
+            marked.append(f"{region:<10} 0x{address:08x} {size:6}  {name}")
+            if region == "flash":
+                missing += 1
+
+    with open(args.output, "w") as report:
+        report.write("Totals\n")
+        report.write(f"{'region':<10} {'code':>8} {'data':>8}\n")
+        for name, _, _ in REGIONS:
+            report.write(f"{name:<10} {totals[name][0]:8} {totals[name][1]:8}\n")
+
+        report.write(f"\nMarked hot, {len(functions)} functions and {len(tables)} tables in the sources\n")
+        report.write("\n".join(marked) + "\n")
+
+        report.write("\nOut of flash\n")
+        report.write("\n".join(lines) + "\n")
+
+    print(f"Placement report written to {args.output}, {missing} of the marked symbols are in flash")
+
+
+if __name__ == "__main__":
+    sys.exit(main())
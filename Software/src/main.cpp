@@ -1,5 +1,8 @@
 #include "include/main.h"
 
+// Create the supervisor first, it has to pick up the reset reason before anything else can reboot us
+Supervisor supervisor;
+
 // set the variables to the default values in case we fail to retrieve the data from the EEPROM
 unsigned int currentNegotiated = Device_Target_Current_Default;
 unsigned int voltageNegotiated = Device_Target_Voltage_Default;
@@ -9,6 +12,7 @@ unsigned int backlightBrightness = Display_Brightness_Default;
 // overcurrent boolean
 bool overcurrent = false;
 bool outputEnabled = false;
+bool rearmPending = false;      // the output is to be turned on once the last trip is in the flash
 
 // set the display parameters
 display_spi_config_t spi_config {
@@ -19,7 +23,7 @@ display_spi_config_t spi_config {
 	.scl = DISP_PIN_SCK,
 	.pio = false,
 	.spi_instance = spi0,
-	.baudrate = 125000000,
+	.baudrate = DISP_SPI_BAUDRATE,
 };
 
 display_config_t config = {
@@ -37,13 +41,47 @@ display_config_t config = {
 // Create the display object
 Driver spi(&config);
 ST7789 display(&spi, &config);
-// Create the GFX objects
+// Create the GFX objects, they draw into the frame buffer so only the UI core may use them
 Print print(display.getFrameBuffer(), &config);
 Graphics graphics(display.getFrameBuffer(), &config);
 Gradients gradients(display.getFrameBuffer(), &config);
 // Create the PicoGFX object
 PicoGFX picoGFX(&print, &graphics, &gradients, nullptr);
 
+// only push the parts of the frame buffer that changed
+screen_config_t screenConfig = {
+	.spi = spi0,
+	.dc = DISP_PIN_DC,
+	.cs = DISP_PIN_CS,
+	.width = DISP_HEIGHT,	// the display is rotated into landscape
+	.height = DISP_WIDTH,
+	.offsetX = DISP_OFFSET_X0,
+	.offsetY = DISP_OFFSET_Y0,
+	.pio = DISP_PIO,
+	.sck = DISP_PIN_SCK,
+	.mosi = DISP_PIN_MOSI,
+	.pioDivider = DISP_PIO_DIVIDER,
+};
+Screen screen(&screenConfig, display.getFrameBuffer());
+// the changed areas are copied here, so the next frame can be rendered while the last one is still going out
+unsigned short transferBuffer[DISP_TRANSFER_BUFFER_SIZE];
+// the readout can also be rendered band by band in the transfer buffer, without going through the frame buffer
+Strip strip(&screen, transferBuffer, screenConfig.width, screenConfig.height, DISP_STRIP_HEIGHT);
+// the background never changes, so it is rendered once and kept in flash
+Background background(display.getFrameBuffer(), screenConfig.width, screenConfig.height, FLASH_BACKGROUND_OFFSET);
+// the readout glyphs are rasterized once, drawing a number is then just a few copies
+GlyphCache glyphCache(display.getFrameBuffer(), screenConfig.width, screenConfig.height);
+// only render when the readout changes, capped by Display_Max_FPS
+Pacer pacer(Display_Max_FPS_Default, DISP_MAX_FRAME_INTERVAL);
+// the backlight is dimmed and then the panel put to sleep when nobody touched the buttons for a while
+Backlight backlight(DISP_PIN_BL);
+Idle idle(Display_Dim_Timeout_Default * 1000000, Display_Sleep_Timeout_Default * 1000000);
+// the press that woke the display up is not acted on
+bool wakePress = false;
+bool wakePosted = false;
+// the trend graph only draws the newest column, the display scrolls the rest
+Graph graph(&screen, display.getFrameBuffer(), screenConfig.width, screenConfig.height, GRAPH_LABEL_WIDTH, GRAPH_MIRRORED);
+
 // Create the objects
 Button buttonUp(BUTTON_UP);
 Button buttonMenu(BUTTON_MENU);
@@ -51,6 +89,73 @@ Button buttonDown(BUTTON_DOWN);
 Memory memory(EEPROM_ADDRESS, i2c0);
 INA219 ina219(INA219_ADDRESS, i2c0);
 Registers registers;
+Recorder recorder(FLASH_RECORDER_OFFSET);
+Formatter formatter;
+Benchmark benchmark;
+// runs the tasks at their own rates, the most urgent one first, one scheduler per core
+Scheduler scheduler;
+Scheduler uiScheduler;
+// splits the time of every loop between its stages, a probe is a read of SysTick, which every core has its own of
+Profiler profiler(STAGE_OTHER);
+Profiler uiProfiler(STAGE_OTHER);
+Image backgroundImage(background_image, background_image_size);
+// draws the background, into the frame buffer once at boot and into every band when the strips are rendered
+Kernels kernels;
+
+// the screen is a tree of widgets, each of them is only drawn again when what it shows changed
+void printLabel(Label* label, Widget_Canvas canvas, void* context);
+Widget_Canvas frameCanvas = {display.getFrameBuffer(), DISP_HEIGHT, 0, DISP_WIDTH};
+Widget root({0, 0, DISP_HEIGHT, DISP_WIDTH});
+// the live readout, the lines are laid out once the height of the glyphs is known
+Widget readoutView({0, 0, DISP_HEIGHT, DISP_WIDTH});
+Readout voltageReadout(&glyphCache, &formatter, 'V', READOUT_COLOR);
+Readout currentReadout(&glyphCache, &formatter, 'A', READOUT_COLOR);
+Readout powerReadout(&glyphCache, &formatter, 'W', READOUT_COLOR);
+Label fpsLabel(printLabel, nullptr, {READOUT_FPS_X, READOUT_FPS_Y, DISP_HEIGHT - READOUT_FPS_X, READOUT_FPS_HEIGHT});
+// the trend graph with the full scale of each series next to it, the graph pushes itself to the display
+Panel graphView(GRAPH_BACKGROUND, {0, 0, DISP_HEIGHT, DISP_WIDTH});
+Plot plot(&graph, {GRAPH_LABEL_WIDTH, 0, DISP_HEIGHT - GRAPH_LABEL_WIDTH, DISP_WIDTH});
+Label graphLabels[GRAPH_SERIES] = {
+	Label(printLabel, nullptr, {GRAPH_LABEL_X, GRAPH_LABEL_Y, GRAPH_LABEL_WIDTH - GRAPH_LABEL_X, GRAPH_LABEL_SPACING}),
+	Label(printLabel, nullptr, {GRAPH_LABEL_X, GRAPH_LABEL_Y + GRAPH_LABEL_SPACING, GRAPH_LABEL_WIDTH - GRAPH_LABEL_X, GRAPH_LABEL_SPACING}),
+	Label(printLabel, nullptr, {GRAPH_LABEL_X, GRAPH_LABEL_Y + 2 * GRAPH_LABEL_SPACING, GRAPH_LABEL_WIDTH - GRAPH_LABEL_X, GRAPH_LABEL_SPACING}),
+};
+// the text pages, the lines are laid out when they are added
+Widget statisticsView({0, 0, DISP_HEIGHT, DISP_WIDTH});
+Label statisticsLines[STATISTICS_LINES] = { printLabel, printLabel, printLabel, printLabel, printLabel };
+Widget pdView({0, 0, DISP_HEIGHT, DISP_WIDTH});
+Label pdLines[PD_LINES] = { printLabel, printLabel, printLabel, printLabel, printLabel };
+Widget settingsView({0, 0, DISP_HEIGHT, DISP_WIDTH});
+Label settingsLines[SETTINGS_LINES] = { printLabel, printLabel, printLabel };
+// only the page that is shown is updated and rendered, the others are skipped entirely
+Pager pager(&root);
+// the timing of the loop on top of the pages, it is opaque so it is drawn again whenever the page draws under it
+Panel overlay(OVERLAY_COLOR, {0, OVERLAY_Y, DISP_HEIGHT, DISP_WIDTH - OVERLAY_Y});
+Label overlayLines[OVERLAY_LINES] = { printLabel, printLabel, printLabel, printLabel };
+
+// the control core samples, protects and serves the host, the UI core draws. They share the latest sample,
+// the commands to the UI core and the flash, and the UI core publishes what the buttons act on
+Measurement measurement;
+Mailbox mailbox;
+Lockout uiLockout;          // parks the UI core while the control core writes the flight recorder
+Lockout controlLockout;     // parks the control core while the UI core saves the background at boot
+unsigned int core1Stack[CORE1_STACK_SIZE / sizeof(unsigned int)];
+volatile bool uiReady = false;
+volatile unsigned int shownPage = PAGE_READOUT;
+volatile unsigned int displayState = IDLE_ACTIVE;
+volatile unsigned int uiFrames = 0;
+volatile bool uiLoad = false;
+volatile bool benchmarkBusy = false;
+// the sample the UI core is drawing
+Measurement_Sample shownSample = {};
+
+// settings page state, while editing the up and down buttons change the selected setting
+volatile bool settingsEditing = false;
+volatile unsigned int settingSelected = SETTING_TRIP_CURRENT;
+
+// running statistics since boot or the last reset, gathered on the control core and published with every sample
+Measurement_Statistics statistics = {};
+unsigned long long statisticsTime = 0;
 
 /**
  * @brief Initialize the I2C busses
@@ -97,6 +202,10 @@ void initLEDs()
 	gpio_put(LEFT_MOSFET, 1);
 	gpio_put(RIGHT_MOSFET, 1);
 
+	// make sure the supervisor turns the output off before it resets the device
+	supervisor.addFailsafePin(LEFT_MOSFET, 1);
+	supervisor.addFailsafePin(RIGHT_MOSFET, 1);
+
 	// set the binary data to show the pins used for the LEDs
 	bi_decl(bi_4pins_with_names(
 		LEFT_MOSFET_LED, "Left MOSFET LED", 
@@ -134,7 +243,7 @@ const long blinkIntervalSequence[4] = { 100000, 62500, 100000, 600000};
  * @brief Blink both LEDs on the board in a pattern if the current is too high!
  * @note Has to be called every loop
 */
-void overCurrentLEDs()
+void HOT_FUNC(overCurrentLEDs)()
 {
 	static int overCurrentSequenceIndex = 0;
 
@@ -166,6 +275,566 @@ void overCurrentLEDs()
 	ledStates = !ledStates;
 }
 
+/**
+ * @brief Load the flight recorder data into the registers
+ * @note PFuse_Record_Page selects which 32 samples show up in PFuse_Record_Data
+*/
+void updateRecordRegisters()
+{
+	const Recorder_Trip* record = recorder.getRecord();
+	bool valid = recorder.hasRecord();
+
+	registers.setProtected(Register_Address::PFuse_Record_Info, 0, valid);
+	registers.setProtected(Register_Address::PFuse_Record_Info, 1, valid ? record->tripCount : 0);
+	registers.setProtected(Register_Address::PFuse_Record_Info, 2, valid ? record->tripTime : 0);
+	registers.setProtected(Register_Address::PFuse_Record_Info, 3, valid ? record->samplePeriod : 0);
+	registers.setProtected(Register_Address::PFuse_Record_Info, 4, valid ? record->tripCurrent : 0);
+	registers.setProtected(Register_Address::PFuse_Record_Info, 5, valid ? record->tripLimit : 0);
+	registers.setProtected(Register_Address::PFuse_Record_Info, 6, valid ? record->sampleCount : 0);
+
+	// each word holds the raw bus voltage in the upper half and the raw current in the lower half
+	unsigned int page = registers.getProtected(Register_Address::PFuse_Record_Page);
+	for(int i = 0; i < RECORD_SAMPLES_PER_PAGE; i++)
+	{
+		Recorder_Sample sample = recorder.getSample(page * RECORD_SAMPLES_PER_PAGE + i);
+		registers.setProtected(Register_Address::PFuse_Record_Data, i, (sample.voltage << 16) | sample.current);
+	}
+}
+
+/**
+ * @brief Load the timing of the last frame into the registers
+*/
+void updateTimingRegisters()
+{
+	Screen_Timing timing = screen.getTiming();
+
+	registers.setProtected(Register_Address::Display_Frame_Timing, 0, timing.render);
+	registers.setProtected(Register_Address::Display_Frame_Timing, 1, timing.transfer);
+	registers.setProtected(Register_Address::Display_Frame_Timing, 2, timing.overlap);
+	registers.setProtected(Register_Address::Display_Frame_Timing, 3, timing.wait);
+	registers.setProtected(Register_Address::Display_Frame_Timing, 4, timing.pixels);
+	registers.setProtected(Register_Address::Display_Render_Load, pacer.getLoad());
+}
+
+/**
+ * @brief Set the backlight and the panel to what the idle state asks for
+ * @note The brightness is capped by Display_Brightness_Limit, and the dimmed brightness never goes above the normal one
+*/
+void applyDisplayPower()
+{
+	unsigned int brightness = MIN(registers.getProtected(Register_Address::Display_Brightness),
+		registers.getProtected(Register_Address::Display_Brightness_Limit));
+
+	switch(idle.getState())
+	{
+		case IDLE_ACTIVE:
+			screen.setPower(SCREEN_POWER_ON);
+			backlight.setLevel(brightness);
+			break;
+		case IDLE_DIMMED:
+			screen.setPower(SCREEN_POWER_ON);
+			backlight.setLevel(MIN(brightness, registers.getProtected(Register_Address::Display_Dim_Brightness)));
+			break;
+		default:
+			// the backlight goes first, so the panel switching off is never seen
+			backlight.setLevel(0);
+			screen.setPower(SCREEN_POWER_SLEEP);
+			break;
+	}
+
+	registers.setProtected(Register_Address::Display_Power_State, idle.getState());
+}
+
+/**
+ * @brief Pick up the idle timeouts from the registers
+*/
+void updateIdleTimeouts()
+{
+	unsigned int dimTimeout = MIN(registers.getProtected(Register_Address::Display_Dim_Timeout), DISP_IDLE_MAX_TIMEOUT);
+	unsigned int sleepTimeout = MIN(registers.getProtected(Register_Address::Display_Sleep_Timeout), DISP_IDLE_MAX_TIMEOUT);
+	idle.setTimeouts(dimTimeout * 1000000, sleepTimeout * 1000000);
+}
+
+/**
+ * @brief Load the timing of the stages and tasks of a core into the registers
+ * @param profiler the profiler of the core
+ * @param scheduler the scheduler of the core
+ * @param ui true for the UI core, false for the control core
+ * @note Each core only writes the rows of its own stages and tasks
+*/
+void publishProfile(Profiler* profiler, Scheduler* scheduler, bool ui)
+{
+	for(unsigned int i = 0; i < STAGES; i++)
+	{
+		if(((STAGES_UI >> i) & 1) != ui)
+			continue;
+
+		Profiler_Stage stage = profiler->getStage(i);
+		registers.setProtected(Register_Address::Device_Loop_Timing, i * 3, stage.min);
+		registers.setProtected(Register_Address::Device_Loop_Timing, i * 3 + 1, stage.avg);
+		registers.setProtected(Register_Address::Device_Loop_Timing, i * 3 + 2, stage.max);
+	}
+
+	for(unsigned int i = 0; i < TASKS; i++)
+	{
+		if((i == TASK_RENDER) != ui)
+			continue;
+
+		Scheduler_Stats stats = scheduler->getStats(i);
+		registers.setProtected(Register_Address::Device_Task_Timing, i * TASK_STATS, stats.runs);
+		registers.setProtected(Register_Address::Device_Task_Timing, i * TASK_STATS + 1, stats.overruns);
+		registers.setProtected(Register_Address::Device_Task_Timing, i * TASK_STATS + 2, stats.lateness);
+		registers.setProtected(Register_Address::Device_Task_Timing, i * TASK_STATS + 3, stats.runtime);
+	}
+}
+
+/**
+ * @brief Load the timing of the control core into the registers
+ * @note Called once per period of the profiler, on the control core
+*/
+void updateControlProfile()
+{
+	publishProfile(&profiler, &scheduler, false);
+	registers.setProtected(Register_Address::Device_Loop_Timing, STAGE_LOOPS, profiler.getLoops());
+	registers.setProtected(Register_Address::Device_Loop_Timing, STAGE_OVERHEAD, profiler.getOverhead());
+	// so a capture of the timing tells which placement it was taken with
+	registers.setProtected(Register_Address::Device_Loop_Timing, STAGE_PLACEMENT, HOT_RAM_ENABLED);
+}
+
+/**
+ * @brief Load the timing of the UI core into the registers, and the timing of both onto the overlay
+ * @note Called once per period of the profiler, on the UI core. The stages of the control core come
+ * from the registers, so they are at most a period old.
+*/
+void updateUIProfile()
+{
+	static const char names[STAGES + 1] = STAGE_NAMES;
+
+	publishProfile(&uiProfiler, &uiScheduler, true);
+	registers.setProtected(Register_Address::Device_Loop_Timing, STAGE_UI_LOOPS, uiProfiler.getLoops());
+
+	unsigned int micros[STAGES][2];
+	for(unsigned int i = 0; i < STAGES; i++)
+	{
+		micros[i][0] = MIN(uiProfiler.toMicroseconds(registers.getProtected(Register_Address::Device_Loop_Timing, i * 3 + 1)), OVERLAY_MAX_VALUE);
+		micros[i][1] = MIN(uiProfiler.toMicroseconds(registers.getProtected(Register_Address::Device_Loop_Timing, i * 3 + 2)), OVERLAY_MAX_VALUE);
+	}
+
+	// the labels only mark themselves as changed when the text does, so this is cheap while the overlay is hidden
+	char text[LABEL_MAX_LENGTH];
+	for(unsigned int line = 0; line < OVERLAY_LINES; line++)
+	{
+		unsigned int left = line * 2;
+		unsigned int right = left + 1;
+		snprintf(text, LABEL_MAX_LENGTH, "%c%4u/%-4u  %c%4u/%-4u",
+			names[left], micros[left][0], micros[left][1], names[right], micros[right][0], micros[right][1]);
+		overlayLines[line].setText(text);
+	}
+}
+
+/**
+ * @brief Write the frozen flight recorder to the flash, once the UI core is out of the way
+ * @return true if the record was written, false if the UI core has not parked yet
+ * @note Never waits, the UI core is asked to park and the write happens on one of the next calls. It parks
+ * in between two widgets, so that takes at most the time one of them takes to draw.
+*/
+bool persistRecorder()
+{
+	uiLockout.request();
+	if(!uiLockout.isParked())
+		return false;
+
+	recorder.persist();
+	uiLockout.release();
+	updateRecordRegisters();
+	return true;
+}
+
+/**
+ * @brief Turn the output on or off
+ * @param enabled true to turn the output on
+ * @note Turning the output on rearms the fuse. If the last trip is not in the flash yet, the output stays
+ * off and the registers task turns it on as soon as the record is written.
+*/
+void HOT_FUNC(setOutput)(bool enabled)
+{
+	rearmPending = false;
+
+	// make sure the last trip made it to the flash before we start recording over it
+	if(enabled && recorder.isPending() && !persistRecorder())
+	{
+		rearmPending = true;
+		return;
+	}
+
+	// the mosfets are active low
+	gpio_put(LEFT_MOSFET, !enabled);
+	gpio_put(RIGHT_MOSFET, !enabled);
+	gpio_put(LEFT_MOSFET_LED, enabled);
+	gpio_put(RIGHT_MOSFET_LED, enabled);
+	outputEnabled = enabled;
+
+	if(!enabled)
+		return;
+
+	recorder.resume();
+	overcurrent = false;
+}
+
+/**
+ * @brief Trip the fuse if the current is above the limit
+ * @note Has to be called every loop, right after fetching new data from the INA219
+*/
+void HOT_FUNC(protectionHandler)()
+{
+	// keep the flight recorder rolling
+	recorder.push(ina219.getBusVoltageRaw(), ina219.getCurrentRaw());
+
+	if(!outputEnabled)
+		return;
+
+	// fixed point, the double helpers of the SDK live in flash and would pull the trip back through XIP
+	int current = ina219.getCurrentMicro();
+	if(current < (int)currentLimit * 1000)
+		return;
+
+	// cut the output first, the recorder only freezes here and is persisted later on
+	setOutput(false);
+	overcurrent = true;
+	recorder.freeze(current / 1000, currentLimit);
+
+	// a trip is something to look at, the display wakes up with the next frame
+	mailbox.post(COMMAND_WAKE);
+}
+
+/**
+ * @brief Start the statistics over
+ * @note Runs on the control core, which owns the statistics
+*/
+void resetStatistics()
+{
+	for(unsigned int i = 0; i < MEASUREMENT_SERIES; i++)
+	{
+		statistics.minimum[i] = INT_MAX;
+		statistics.maximum[i] = INT_MIN;
+		statistics.sum[i] = 0;
+	}
+	statistics.count = 0;
+	statistics.energy = 0;
+	statistics.charge = 0;
+	statisticsTime = time_us_64();
+}
+
+/**
+ * @brief Add a sample to the statistics
+ * @param samples the voltage, current and power in micro units
+ * @note Called by the sampling task with every sample, the UI core only gets the totals along with the sample it reads
+*/
+void collectStatistics(const int* samples)
+{
+	for(unsigned int i = 0; i < MEASUREMENT_SERIES; i++)
+	{
+		statistics.minimum[i] = MIN(statistics.minimum[i], samples[i]);
+		statistics.maximum[i] = MAX(statistics.maximum[i], samples[i]);
+		statistics.sum[i] += samples[i];
+	}
+	statistics.count++;
+
+	// integrate over the time since the last sample, in milliseconds so a day of 100W still fits
+	unsigned long long now = time_us_64();
+	long long elapsed = (now - statisticsTime) / 1000;
+	statistics.energy += samples[GRAPH_SERIES_POWER] * elapsed;
+	statistics.charge += samples[GRAPH_SERIES_CURRENT] * elapsed;
+	statisticsTime = now - (now - statisticsTime) % 1000;
+}
+
+// scratch space for the benchmarks, global so the work can not be optimized away
+char benchmarkText[READOUT_LINE_LENGTH];
+int benchmarkValue = 0;
+
+/**
+ * @brief Format a value the old way, through printf with soft floats
+ * @param context unused
+*/
+void benchmarkFormatPrintf(void* context)
+{
+	double value = benchmarkValue / 1000000.0;
+	snprintf(benchmarkText, READOUT_LINE_LENGTH, "%.1f%c\n", value, 'V');
+	benchmarkValue += 4000;
+}
+
+/**
+ * @brief Format a value through the fixed point formatter
+ * @param context unused
+*/
+void benchmarkFormatFixed(void* context)
+{
+	formatter.format(benchmarkText, READOUT_LINE_LENGTH, benchmarkValue, 'V');
+	benchmarkValue += 4000;
+}
+
+/**
+ * @brief Copy the top half of the background raw out of the flash cache, through XIP
+ * @param context unused
+*/
+void benchmarkImageRaw(void* context)
+{
+	memcpy(transferBuffer, (const void*)(XIP_BASE + FLASH_BACKGROUND_OFFSET + BACKGROUND_HEADER_SIZE),
+		DISP_TRANSFER_BUFFER_SIZE * sizeof(unsigned short));
+}
+
+/**
+ * @brief Decode the top half of the compressed background image
+ * @param context unused
+*/
+void benchmarkImageDecode(void* context)
+{
+	backgroundImage.draw(transferBuffer, screenConfig.width, 0, 0, screenConfig.width, DISP_TRANSFER_BUFFER_SIZE / screenConfig.width);
+}
+
+/**
+ * @brief Redraw the readout through the frame buffer, restoring the whole background and pushing the whole frame
+ * @param context unused
+*/
+void benchmarkFullFrame(void* context)
+{
+	background.restoreAll();
+	readoutView.paint(frameCanvas);
+	screen.invalidateAll();
+	screen.update();
+}
+
+/**
+ * @brief Redraw the readout band by band
+ * @param context unused
+*/
+void benchmarkStrips(void* context)
+{
+	strip.renderAll();
+	screen.wait();
+}
+
+/**
+ * @brief Push the entire frame buffer to the display
+ * @param context unused
+*/
+void benchmarkDisplay(void* context)
+{
+	screen.invalidateAll();
+	screen.update();
+}
+
+void redrawScreen();
+
+unsigned short benchmarkRamp[KERNELS_RAMP_SIZE];
+
+/**
+ * @brief Draw the boot background through PicoGFX, the way it was drawn before the kernels took over
+ * @param context unused
+*/
+void benchmarkGradientPicoGFX(void* context)
+{
+	picoGFX.getGradients().drawRotCircleGradient(display.getCenter(), DISP_HEIGHT, 10, Colors::OrangeRed, Colors::DarkYellow);
+}
+
+/**
+ * @brief Draw a full screen linear gradient
+ * @param context unused
+*/
+void benchmarkLinear(void* context)
+{
+	kernels.linear(display.getFrameBuffer(), screenConfig.width, {0, 0, screenConfig.width, screenConfig.height});
+}
+
+/**
+ * @brief Draw a full screen radial gradient
+ * @param context unused
+*/
+void benchmarkRadial(void* context)
+{
+	kernels.radial(display.getFrameBuffer(), screenConfig.width, {0, 0, screenConfig.width, screenConfig.height});
+}
+
+/**
+ * @brief Draw a rotated texture, from the start of the transfer buffer into the part right after it
+ * @param context unused
+*/
+void benchmarkRotate(void* context)
+{
+	const unsigned int size = 1 << BENCHMARK_TEXTURE_BITS;
+	kernels.rotate(&transferBuffer[size * size], size, {0, 0, size, size}, transferBuffer, BENCHMARK_TEXTURE_BITS, size / 2, size / 2, 30);
+}
+
+/**
+ * @brief Fill a table with the colors between two colors
+ * @param context unused
+*/
+void benchmarkColorRamp(void* context)
+{
+	kernels.ramp(benchmarkRamp, KERNELS_RAMP_SIZE, 0xfa20, 0xafe5);
+}
+
+/**
+ * @brief Turn the average cycles per call of a benchmark into pixels per second
+ * @param pixels the number of pixels drawn per call
+ * @param cycles the cycles per call
+ * @return the pixels per second
+*/
+unsigned int pixelsPerSecond(unsigned int pixels, unsigned int cycles)
+{
+	return (unsigned long long)pixels * clock_get_hz(clk_sys) / MAX(cycles, 1);
+}
+
+/**
+ * @brief Run one of the benchmarks and put the results in the registers
+ * @param id the identifier of the benchmark
+ * @note Runs on the UI core, they all draw or take the time the drawing would have
+*/
+void benchmarkHandler(unsigned int id)
+{
+	switch(id)
+	{
+		case BENCHMARK_FORMAT:
+			benchmarkValue = 0;
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 0, benchmark.run(benchmarkFormatPrintf));
+			benchmarkValue = 0;
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 1, benchmark.run(benchmarkFormatFixed));
+			break;
+		case BENCHMARK_IMAGE:
+			// the transfer buffer is used as the destination, so make sure the display is done with it
+			screen.wait();
+			benchmark.setIterations(BENCHMARK_IMAGE_ITERATIONS);
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 0, benchmark.run(benchmarkImageRaw));
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 1, benchmark.run(benchmarkImageDecode));
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 2, background_image_size);
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 3, backgroundImage.getWidth() * backgroundImage.getHeight() * sizeof(unsigned short));
+			benchmark.setIterations(BENCHMARK_DEFAULT_ITERATIONS);
+			break;
+		case BENCHMARK_STRIP:
+			// both of them draw the readout, so it has to be the page that is shown
+			if(pager.getCurrent() != PAGE_READOUT)
+				break;
+			benchmark.setIterations(BENCHMARK_STRIP_ITERATIONS);
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 0, benchmark.run(benchmarkFullFrame));
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 1, benchmark.run(benchmarkStrips));
+			// PicoGFX allocates the frame buffer either way, the strips only shrink the transfer buffer
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 2, DISP_WIDTH * DISP_HEIGHT * sizeof(unsigned short) + sizeof(transferBuffer));
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 3, strip.getBufferSize());
+			benchmark.setIterations(BENCHMARK_DEFAULT_ITERATIONS);
+			break;
+		case BENCHMARK_DISPLAY:
+		{
+			benchmark.setIterations(BENCHMARK_DISPLAY_ITERATIONS);
+			unsigned int cycles = benchmark.run(benchmarkDisplay);
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 0, cycles);
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 1,
+				(unsigned long long)DISP_WIDTH * DISP_HEIGHT * sizeof(unsigned short) * clock_get_hz(clk_sys) / cycles);
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 2, screen.getClock());
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 3, screenConfig.pio != nullptr);
+			benchmark.setIterations(BENCHMARK_DEFAULT_ITERATIONS);
+#ifdef DISP_STRIP_RENDERING
+			// the frame buffer does not hold the readout, so draw it again
+			strip.renderAll();
+#endif
+			break;
+		}
+		case BENCHMARK_KERNELS:
+		{
+			// the gradients are drawn over the readout, and the transfer buffer is used as scratch space
+			if(graph.isVisible())
+				break;
+			screen.wait();
+
+			const unsigned int frame = screenConfig.width * screenConfig.height;
+			const unsigned int texture = (1 << BENCHMARK_TEXTURE_BITS) * (1 << BENCHMARK_TEXTURE_BITS);
+			Point center = display.getCenter();
+			benchmark.setIterations(BENCHMARK_KERNELS_ITERATIONS);
+			registers.setProtected(Register_Address::Device_Benchmark_Result, 0, pixelsPerSecond(frame, benchmark.run(benchmarkGradientPicoGFX)));
+			for(unsigned int i = 0; i < 2; i++)
+			{
+				// the plain loops first, then the interpolators
+				kernels.setInterpolator(i == 1);
+				kernels.setLinear(center.x, center.y, DISP_HEIGHT, BACKGROUND_ANGLE, BACKGROUND_FROM, BACKGROUND_TO);
+				kernels.setRadial(center.x, center.y, DISP_HEIGHT / 2, BACKGROUND_FROM, BACKGROUND_TO);
+				registers.setProtected(Register_Address::Device_Benchmark_Result, 1 + i * 4, pixelsPerSecond(frame, benchmark.run(benchmarkLinear)));
+				registers.setProtected(Register_Address::Device_Benchmark_Result, 2 + i * 4, pixelsPerSecond(frame, benchmark.run(benchmarkRadial)));
+				registers.setProtected(Register_Address::Device_Benchmark_Result, 3 + i * 4, pixelsPerSecond(texture, benchmark.run(benchmarkRotate)));
+				registers.setProtected(Register_Address::Device_Benchmark_Result, 4 + i * 4, pixelsPerSecond(KERNELS_RAMP_SIZE, benchmark.run(benchmarkColorRamp)));
+			}
+			benchmark.setIterations(BENCHMARK_DEFAULT_ITERATIONS);
+			redrawScreen();
+			break;
+		}
+		default:
+			break;
+	}
+}
+
+// the latency benchmark runs over several seconds, stepped by the registers task
+unsigned int latencyPhase = 0;      // 0 while it is not running, 1 with the UI idle, 2 with the UI redrawing
+unsigned int latencyStart = 0;
+unsigned int latencyFrames = 0;
+
+/**
+ * @brief Start timing the sampling task, first with the UI idle and then with the UI drawing as fast as it can
+ * @note Runs on the control core, the results are in after both phases
+*/
+void startLatencyBenchmark()
+{
+	for(unsigned int i = 0; i < 6; i++)
+		registers.setProtected(Register_Address::Device_Benchmark_Result, i, 0);
+
+	latencyPhase = 1;
+	latencyStart = time_us_32();
+	latencyFrames = uiFrames;
+	mailbox.post(COMMAND_LOAD, 0);
+}
+
+/**
+ * @brief Gather the worst lateness and runtime of the sampling task, and move on to the next phase when it is time
+ * @note Has to be called every pass of the registers task
+*/
+void stepLatencyBenchmark()
+{
+	if(latencyPhase == 0)
+		return;
+
+	unsigned int now = time_us_32();
+	unsigned int elapsed = now - latencyStart;
+	unsigned int index = (latencyPhase - 1) * 3;
+
+	// only the statistics of the seconds that lie entirely within the phase count
+	if(elapsed >= BENCHMARK_LATENCY_SETTLE)
+	{
+		Scheduler_Stats stats = scheduler.getStats(TASK_SAMPLING);
+		registers.setProtected(Register_Address::Device_Benchmark_Result, index,
+			MAX(registers.getProtected(Register_Address::Device_Benchmark_Result, index), stats.lateness));
+		registers.setProtected(Register_Address::Device_Benchmark_Result, index + 1,
+			MAX(registers.getProtected(Register_Address::Device_Benchmark_Result, index + 1), stats.runtime));
+	}
+
+	if(elapsed < BENCHMARK_LATENCY_PHASE)
+		return;
+
+	// the frame rate tells whether the UI was actually busy
+	registers.setProtected(Register_Address::Device_Benchmark_Result, index + 2,
+		(unsigned long long)(uiFrames - latencyFrames) * 1000000 / elapsed);
+
+	if(latencyPhase == 1)
+	{
+		latencyPhase = 2;
+		latencyStart = now;
+		latencyFrames = uiFrames;
+		mailbox.post(COMMAND_LOAD, 1);
+		return;
+	}
+
+	latencyPhase = 0;
+	mailbox.post(COMMAND_LOAD, 0);
+	registers.setProtected(Register_Address::Device_Benchmark, Device_Benchmark_Default);
+	benchmarkBusy = false;
+}
+
 /**
  * @brief Handle the register access from writing to them or reading from them
  * @note Has to be called every loop
@@ -180,19 +849,34 @@ void RegisterHandler(bool all = false)
 			// reset the device into bootloader mode
 			// the intellisense doesnt like this function so we have to disable it until we build
 #ifndef __INTELLISENSE__
-			//multicore_reset_core1();
+			multicore_reset_core1();
 			reset_usb_boot(0, 0);
 			while(1);
 #endif			
 		}
 		if(registers.getProtected(Register_Address::Device_Reset))
 		{
-			watchdog_reboot(0, SRAM_END, 0);
-			while(1);
+			supervisor.reboot();
 		}
 		if(registers.getProtected(Register_Address::Device_Self_Test))
 		{
 		}
+		// the benchmarks take a while and run elsewhere, only one at a time, until then Device_Benchmark holds on to its value
+		unsigned int id = registers.getProtected(Register_Address::Device_Benchmark);
+		if(id != Device_Benchmark_Default && !benchmarkBusy)
+		{
+			benchmarkBusy = true;
+			if(id == BENCHMARK_LATENCY)
+				startLatencyBenchmark();
+			else if(!mailbox.post(COMMAND_BENCHMARK, id))
+				benchmarkBusy = false;
+		}
+
+		// the host might have picked another page of the flight recorder
+		updateRecordRegisters();
+
+		// the frame rate cap, the brightness or the idle timeouts might have changed
+		mailbox.post(COMMAND_REGISTERS);
 	}
 	else
 	{
@@ -286,33 +970,716 @@ void processUSBData()
 }
 
 
+/**
+ * @brief Change the selected setting
+ * @param steps the number of steps up, or down if negative
+*/
+void adjustSetting(int steps)
+{
+	if(settingSelected == SETTING_TRIP_CURRENT)
+	{
+		int limit = (int)currentLimit + steps * SETTINGS_TRIP_STEP;
+		currentLimit = MIN(MAX(limit, SETTINGS_TRIP_MIN), SETTINGS_TRIP_MAX);
+		registers.setProtected(Register_Address::PFuse_Trip_Current, currentLimit);
+	}
+	else if(settingSelected == SETTING_MAX_FPS)
+	{
+		int fps = (int)registers.getProtected(Register_Address::Display_Max_FPS) + steps * SETTINGS_FPS_STEP;
+		fps = MIN(MAX(fps, 0), SETTINGS_FPS_MAX);
+		registers.setProtected(Register_Address::Display_Max_FPS, fps);
+		mailbox.post(COMMAND_REGISTERS);
+	}
+}
+
+/**
+ * @brief Go to the next setting, or stop editing after the last one
+ * @note The trip current is written to the EEPROM once editing is done, so it survives a reboot
+*/
+void nextSetting()
+{
+	settingSelected++;
+	if(settingSelected < SETTINGS)
+		return;
+
+	settingsEditing = false;
+	settingSelected = SETTING_TRIP_CURRENT;
+	if(memory.verifyConnection())
+		memory.writeWord(MEMORY_CURRENT_LIMIT_ADDRESS, currentLimit);
+}
+
+/**
+ * @brief Act on the page that is shown, after the menu button was clicked
+*/
+void pageAction()
+{
+	switch(shownPage)
+	{
+		case PAGE_STATISTICS:
+			// the statistics live on this core, the page shows the reset with the next sample
+			resetStatistics();
+			break;
+		case PAGE_SETTINGS:
+			settingsEditing = true;
+			settingSelected = SETTING_TRIP_CURRENT;
+			break;
+		default:
+			break;
+	}
+}
+
 /**
  * @brief Button handler
  * @note Has to be called every loop
 */
 void buttonHandler()
 {
+	// any press keeps the display awake, the one that wakes it up is thrown away once it is released
+	bool pressed = buttonUp.isPressed() || buttonMenu.isPressed() || buttonDown.isPressed();
+	if(pressed && !wakePosted)
+	{
+		if(displayState != IDLE_ACTIVE)
+			wakePress = true;
+		wakePosted = mailbox.post(COMMAND_WAKE);
+	}
+	if(!pressed)
+		wakePosted = false;
+	if(wakePress)
+	{
+		wakePress = pressed;
+		buttonUp.clear();
+		buttonMenu.clear();
+		buttonDown.clear();
+	}
+
 	if(buttonMenu.isHeld())
 	{
-		static bool state = true;
-		state = !state;
-		gpio_put(LEFT_MOSFET, !state);
-		gpio_put(RIGHT_MOSFET, !state);
-		gpio_put(LEFT_MOSFET_LED, state);
-		gpio_put(RIGHT_MOSFET_LED, state);
+		setOutput(!(outputEnabled || rearmPending));
 		printf("MENU held\n");
 	}
 
+	// while editing a setting the up and down buttons change it, otherwise they go through the pages
+	if(settingsEditing)
+	{
+		if(buttonUp.isClicked())
+			adjustSetting(1);
+		if(buttonDown.isClicked())
+			adjustSetting(-1);
+		if(buttonMenu.isClicked())
+			nextSetting();
+	}
+	else
+	{
+		if(buttonUp.isClicked())
+			mailbox.post(COMMAND_PAGE, 0);
+		if(buttonDown.isClicked())
+			mailbox.post(COMMAND_PAGE, 1);
+		if(buttonMenu.isClicked())
+			pageAction();
+	}
+
 	buttonUp.update();
 	buttonMenu.update();
 	buttonDown.update();
 }
 
-void getFormat(double value, char unit);
+#ifndef READOUT_FONT_ASSET
+/**
+ * @brief Rasterize the readout glyphs into the glyph cache
+ * @note Uses the frame buffer as scratch space, so it has to run before the background is rendered
+*/
+void initGlyphs()
+{
+	unsigned short* frameBuffer = display.getFrameBuffer();
+	memset(frameBuffer, 0, screenConfig.width * screenConfig.height * sizeof(unsigned short));
+
+	picoGFX.getPrint().setFont(&RobotoMono48);
+	picoGFX.getPrint().setColor(Colors::White);
+
+	// the cursor moving down a line tells us how tall the glyphs are
+	picoGFX.getPrint().setCursor(Point(0, 0));
+	picoGFX.getPrint().setString("\n");
+	picoGFX.getPrint().print();
+	glyphCache.setHeight(picoGFX.getPrint().getCursor().y);
+
+	// print each glyph white on black in the corner, and capture it as far as the cursor advanced
+	for(const char* character = READOUT_GLYPHS; *character; character++)
+	{
+		picoGFX.getPrint().setCursor(Point(0, 0));
+		picoGFX.getPrint().setString("%c", *character);
+		picoGFX.getPrint().print();
+		glyphCache.capture(*character, 0, 0, picoGFX.getPrint().getCursor().x);
+		memset(frameBuffer, 0, screenConfig.width * glyphCache.getHeight() * sizeof(unsigned short));
+	}
+}
+#endif
+
+/**
+ * @brief Label font, prints the text through PicoGFX
+ * @param label the label to draw
+ * @param canvas the pixels to draw into
+ * @param context unused
+ * @note PicoGFX can only draw into the frame buffer, so the labels do not show up in the strips
+*/
+void printLabel(Label* label, Widget_Canvas canvas, void* context)
+{
+	if(canvas.pixels != display.getFrameBuffer())
+		return;
+
+	Screen_Rect bounds = label->getBounds();
+	picoGFX.getPrint().setFont(&RobotoMono24);
+	picoGFX.getPrint().setColor(label->getColor());
+	picoGFX.getPrint().setCursor(Point(bounds.x, bounds.y));
+	picoGFX.getPrint().setString("%s", label->getText());
+	if(label->isCentered())
+		picoGFX.getPrint().center(Alignment_t::HorizontalCenter);
+	picoGFX.getPrint().print();
+}
+
+/**
+ * @brief Strip layer, draw the background gradient into the band
+ * @param band the pixels of the band
+ * @param area the area of the screen the band covers
+ * @param context unused
+ * @note The same kernel filled the frame buffer at boot, so the bands match it pixel for pixel
+*/
+void stripBackground(unsigned short* band, Screen_Rect area, void* context)
+{
+	uiProfiler.enter(STAGE_BACKGROUND);
+	Kernels::linearLayer(band, area, &kernels);
+	uiProfiler.leave();
+}
+
+/**
+ * @brief Page update, hand the latest sample to the readout
+ * @param context unused
+*/
+void updateReadoutPage(void* context)
+{
+	voltageReadout.setValue(shownSample.voltage);
+	currentReadout.setValue(shownSample.current);
+	powerReadout.setValue(shownSample.power);
+
+	char text[LABEL_MAX_LENGTH];
+	snprintf(text, LABEL_MAX_LENGTH, "%d fps", screen.getFrameCounter());
+	fpsLabel.setText(text);
+}
+
+/**
+ * @brief Page update, show the full scale of each series of the graph
+ * @param context unused
+*/
+void updateGraphPage(void* context)
+{
+	static const char units[GRAPH_SERIES] = { 'V', 'A', 'W' };
+
+	char text[LABEL_MAX_LENGTH];
+	for(unsigned int i = 0; i < GRAPH_SERIES; i++)
+	{
+		formatter.format(text, LABEL_MAX_LENGTH, graph.getScale(i), units[i]);
+		graphLabels[i].setText(text);
+	}
+}
+
+/**
+ * @brief Format a value into a column of a page line
+ * @param text the line, the value is appended to it
+ * @param value the value in micro units
+ * @param unit the unit of the value
+ * @param suffix appended after the unit, can be empty
+*/
+void formatColumn(char* text, int value, char unit, const char* suffix)
+{
+	char column[READOUT_LINE_LENGTH];
+	unsigned int length = formatter.format(column, READOUT_LINE_LENGTH, value, unit);
+	snprintf(column + length, READOUT_LINE_LENGTH - length, "%s", suffix);
+
+	unsigned int used = strlen(text);
+	snprintf(text + used, LABEL_MAX_LENGTH - used, "%-7s", column);
+}
+
+/**
+ * @brief Page update, show the minimum, average and maximum of each series, and what went through the output
+ * @param context unused
+*/
+void updateStatisticsPage(void* context)
+{
+	static const char units[MEASUREMENT_SERIES] = { 'V', 'A', 'W' };
+
+	// all from the same publish as the sample shown
+	const Measurement_Statistics* shown = &shownSample.statistics;
+	if(shown->count == 0)
+		return;
+
+	char text[LABEL_MAX_LENGTH];
+	for(unsigned int i = 0; i < MEASUREMENT_SERIES; i++)
+	{
+		text[0] = 0;
+		formatColumn(text, shown->minimum[i], units[i], "");
+		formatColumn(text, shown->sum[i] / shown->count, units[i], "");
+		formatColumn(text, shown->maximum[i], units[i], "");
+		statisticsLines[1 + i].setText(text);
+	}
+
+	// from uW ms and uA ms to uWh and uAh
+	text[0] = 0;
+	formatColumn(text, shown->energy / 3600000, 'W', "h");
+	formatColumn(text, shown->charge / 3600000, 'A', "h");
+	statisticsLines[4].setText(text);
+}
+
+/**
+ * @brief Page update, show what the USB-PD source offers and what we asked for
+ * @param context unused
+ * @note The USB-PD registers are filled in by the FUSB302 driver, until then they read as no PD source
+*/
+void updatePDPage(void* context)
+{
+	bool pd = registers.getProtected(Register_Address::USB_PD_IsPD);
+	bool pps = registers.getProtected(Register_Address::USB_PD_HasPPS);
+
+	char text[LABEL_MAX_LENGTH];
+	snprintf(text, LABEL_MAX_LENGTH, "PD %-4sPPS %s", pd ? "yes" : "no", pps ? "yes" : "no");
+	pdLines[1].setText(text);
+
+	// the registers hold millivolts and milliamps
+	snprintf(text, LABEL_MAX_LENGTH, "Offer  ");
+	formatColumn(text, registers.getProtected(Register_Address::USB_PD_Voltage) * 1000, 'V', "");
+	formatColumn(text, registers.getProtected(Register_Address::USB_PD_Current) * 1000, 'A', "");
+	pdLines[2].setText(text);
+
+	snprintf(text, LABEL_MAX_LENGTH, "Range  ");
+	if(pps)
+	{
+		formatColumn(text, registers.getProtected(Register_Address::USB_PD_Voltage_Min) * 1000, 'V', "");
+		formatColumn(text, registers.getProtected(Register_Address::USB_PD_Voltage_Max) * 1000, 'V', "");
+	}
+	pdLines[3].setText(text);
+
+	snprintf(text, LABEL_MAX_LENGTH, "Target ");
+	formatColumn(text, voltageNegotiated * 1000, 'V', "");
+	formatColumn(text, currentNegotiated * 1000, 'A', "");
+	pdLines[4].setText(text);
+}
+
+/**
+ * @brief Page update, show the settings and mark the one that is being edited
+ * @param context unused
+*/
+void updateSettingsPage(void* context)
+{
+	char text[LABEL_MAX_LENGTH];
+	snprintf(text, LABEL_MAX_LENGTH, "Trip    ");
+	formatColumn(text, currentLimit * 1000, 'A', "");
+	settingsLines[SETTING_TRIP_CURRENT].setText(text);
+
+	unsigned int fps = registers.getProtected(Register_Address::Display_Max_FPS);
+	if(fps == 0)
+		snprintf(text, LABEL_MAX_LENGTH, "Max FPS off");
+	else
+		snprintf(text, LABEL_MAX_LENGTH, "Max FPS %d", fps);
+	settingsLines[SETTING_MAX_FPS].setText(text);
+
+	for(unsigned int i = 0; i < SETTINGS; i++)
+		settingsLines[i].setColor(settingsEditing && i == settingSelected ? PAGE_SELECTED_COLOR : PAGE_LINE_COLOR);
+	settingsLines[SETTINGS].setText(settingsEditing ? "UP/DOWN to change" : "MENU to edit");
+}
+
+/**
+ * @brief Lay out the lines of a text page
+ * @param page the page
+ * @param lines the lines, from top to bottom
+ * @param count the number of lines
+*/
+void addLines(Widget* page, Label* lines, unsigned int count)
+{
+	for(unsigned int i = 0; i < count; i++)
+	{
+		lines[i].setBounds({PAGE_LINE_X, PAGE_LINE_Y + i * PAGE_LINE_HEIGHT, DISP_HEIGHT - PAGE_LINE_X, PAGE_LINE_HEIGHT});
+		lines[i].setColor(PAGE_LINE_COLOR);
+		page->add(&lines[i]);
+	}
+}
+
+/**
+ * @brief Put the pages together and lay out the readout
+ * @note The glyph cache has to be filled already, the lines are as tall as its glyphs
+*/
+void initWidgets()
+{
+	static const Colors_t colors[GRAPH_SERIES] = { Colors::GreenYellow, Colors::OrangeRed, Colors::White };
+
+	// the pages are added before they are filled, so the graph is not told to hide before it was ever shown
+	pager.add(&readoutView, updateReadoutPage);
+	pager.add(&graphView, updateGraphPage);
+	pager.add(&statisticsView, updateStatisticsPage);
+	pager.add(&pdView, updatePDPage);
+	pager.add(&settingsView, updateSettingsPage);
+
+	graphView.add(&plot);
+	for(unsigned int i = 0; i < GRAPH_SERIES; i++)
+	{
+		graphLabels[i].setColor(colors[i]);
+		graphView.add(&graphLabels[i]);
+	}
+
+	// the power line sits a bit further down
+	unsigned int height = glyphCache.getHeight();
+	voltageReadout.setBounds({0, 0, screenConfig.width, height});
+	currentReadout.setBounds({0, height, screenConfig.width, height});
+	powerReadout.setBounds({0, 2 * height + READOUT_POWER_SPACING, screenConfig.width, height});
+	fpsLabel.setColor(Colors::GreenYellow);
+	readoutView.add(&voltageReadout);
+	readoutView.add(&currentReadout);
+	readoutView.add(&powerReadout);
+	readoutView.add(&fpsLabel);
+
+	addLines(&statisticsView, statisticsLines, STATISTICS_LINES);
+	statisticsLines[0].setColor(PAGE_HEADER_COLOR);
+	statisticsLines[0].setText("min    avg    max");
+
+	addLines(&pdView, pdLines, PD_LINES);
+	pdLines[0].setColor(PAGE_HEADER_COLOR);
+	pdLines[0].setText("USB-PD source");
+
+	addLines(&settingsView, settingsLines, SETTINGS_LINES);
+	settingsLines[SETTINGS].setColor(PAGE_HEADER_COLOR);
+
+	// the overlay goes on last, on top of every page
+	for(unsigned int i = 0; i < OVERLAY_LINES; i++)
+	{
+		overlayLines[i].setBounds({OVERLAY_X, OVERLAY_Y + i * PAGE_LINE_HEIGHT, DISP_HEIGHT - OVERLAY_X, PAGE_LINE_HEIGHT});
+		overlayLines[i].setColor(OVERLAY_TEXT_COLOR);
+		overlay.add(&overlayLines[i]);
+	}
+	overlay.setVisible(false);
+	root.add(&overlay);
+}
+
+/**
+ * @brief Draw the whole screen again, over whatever ended up on it
+*/
+void redrawScreen()
+{
+	root.invalidate();
+	pacer.request();
+}
+
+/**
+ * @brief Called in between the widgets of a frame, parks the UI core when the control core wants the flash
+ * @param context unused
+*/
+void yieldUI(void* context)
+{
+	if(uiLockout.isRequested())
+		uiLockout.park();
+}
+
+/**
+ * @brief Wait for the display to be done with the last frame, parking meanwhile if the control core asks for it
+*/
+void waitForScreen()
+{
+	while(screen.isBusy())
+		yieldUI(nullptr);
+}
+
+/**
+ * @brief Called every now and then while a benchmark runs, which can take seconds
+ * @param context unused
+ * @note The benchmarks run from the render task, so it has to report in and park for the control core like a frame would
+*/
+void benchmarkAlive(void* context)
+{
+	supervisor.heartbeat(TASK_RENDER);
+	yieldUI(nullptr);
+}
+
+/**
+ * @brief Sample the INA219, trip the fuse if needed and publish the sample for everyone else
+ * @param context unused
+ * @note The most urgent task of the control core, nothing the UI core does can hold it up
+*/
+void samplingTask(void* context)
+{
+	supervisor.heartbeat(TASK_SAMPLING);
+	profiler.mark(STAGE_SAMPLING);
+	ina219.getData();
+	unsigned int time = time_us_32();
+	protectionHandler();
+	overCurrentLEDs();
+
+	// the fuse goes first, then the sample and the state it left the output in are handed to everyone else
+	Measurement_Sample sample = {};
+	sample.time = time;
+	sample.flags = (outputEnabled ? SAMPLE_OUTPUT_ENABLED : 0) | (overcurrent ? SAMPLE_OVERCURRENT : 0);
+	sample.voltage = ina219.getVoltageMicro();
+	sample.current = ina219.getCurrentMicro();
+	sample.power = ina219.getPowerMicro();
+	sample.busVoltageRaw = ina219.getBusVoltageRaw();
+	sample.shuntVoltageRaw = ina219.getShuntVoltageRaw();
+	sample.currentRaw = ina219.getCurrentRaw();
+	sample.powerRaw = ina219.getPowerRaw();
+
+	// every sample goes into the statistics, the UI core would only see the ones that happen to be latest when it looks
+	int series[MEASUREMENT_SERIES] = { sample.voltage, sample.current, sample.power };
+	collectStatistics(series);
+	sample.statistics = statistics;
+	measurement.publish(&sample);
+	profiler.mark(STAGE_OTHER);
+}
+
+/**
+ * @brief Serve the host over USB
+ * @param context unused
+*/
+void usbTask(void* context)
+{
+	supervisor.heartbeat(TASK_USB);
+	profiler.mark(STAGE_USB);
+	processUSBData();
+	profiler.mark(STAGE_OTHER);
+}
+
+/**
+ * @brief Keep the registers up to date
+ * @param context unused
+*/
+void registersTask(void* context)
+{
+	supervisor.heartbeat(TASK_REGISTERS);
+	profiler.mark(STAGE_REGISTERS);
+	RegisterHandler();
+	stepLatencyBenchmark();
+
+	// persist the flight recorder now that the output is safely off, as soon as the UI core parked
+	if(recorder.isPending() && persistRecorder() && rearmPending)
+		setOutput(true);
+
+	// transfer the latest sample to the registers for external access, the values and the fuse state all from the same sample
+	Measurement_Sample sample = measurement.read();
+	registers.setProtected(Register_Address::Bus_Voltage, sample.busVoltageRaw);
+	registers.setProtected(Register_Address::Shunt_Voltage, sample.shuntVoltageRaw);
+	registers.setProtected(Register_Address::Current, sample.currentRaw);
+	registers.setProtected(Register_Address::Power, sample.powerRaw);
+	registers.setProtected(Register_Address::PFuse_Status, (sample.flags & SAMPLE_OVERCURRENT) != 0);
+	profiler.mark(STAGE_OTHER);
+}
+
+/**
+ * @brief Act on the buttons
+ * @param context unused
+*/
+void buttonsTask(void* context)
+{
+	supervisor.heartbeat(TASK_BUTTONS);
+	profiler.mark(STAGE_BUTTONS);
+	buttonHandler();
+	profiler.mark(STAGE_OTHER);
+}
+
+/**
+ * @brief Act on a command from the control core
+ * @param command the command
+ * @param argument what came along with it
+ * @note Runs on the UI core
+*/
+void commandHandler(unsigned int command, unsigned int argument)
+{
+	switch(command)
+	{
+		case COMMAND_PAGE:
+			if(argument)
+				pager.next();
+			else
+				pager.previous();
+			shownPage = pager.getCurrent();
+			break;
+		case COMMAND_WAKE:
+			// the state changes right away, the render task applies it
+			idle.activity();
+			break;
+		case COMMAND_REGISTERS:
+			// 0 turns the pacing off and renders every loop
+			pacer.setMaxFPS(uiLoad ? 0 : registers.getProtected(Register_Address::Display_Max_FPS));
+			updateIdleTimeouts();
+			applyDisplayPower();
+			break;
+		case COMMAND_BENCHMARK:
+			benchmarkHandler(argument);
+			registers.setProtected(Register_Address::Device_Benchmark, Device_Benchmark_Default);
+			benchmarkBusy = false;
+			break;
+		case COMMAND_LOAD:
+			// a sleeping display would not draw at all
+			uiLoad = argument;
+			pacer.setMaxFPS(uiLoad ? 0 : registers.getProtected(Register_Address::Display_Max_FPS));
+			if(uiLoad)
+				idle.activity();
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * @brief Update the pages and render a frame when one is due
+ * @param context unused
+ * @note Runs on the UI core, along with everything that draws
+*/
+void renderTask(void* context)
+{
+	supervisor.heartbeat(TASK_RENDER);
+	yieldUI(nullptr);
+
+	// the commands from the control core first, they might change what is shown
+	unsigned int command, argument;
+	while(mailbox.receive(&command, &argument))
+		commandHandler(command, argument);
+
+	// dim and sleep when nobody is looking, wake up right away on a button or a trip
+	if(idle.update())
+		applyDisplayPower();
+	displayState = idle.getState();
+
+	// all the values from the same sample, however far the control core got in the meantime
+	shownSample = measurement.read();
+
+	// only meaningful when the board itself is powered through the shunt
+	idle.measure(shownSample.current);
+	for(unsigned int i = 0; i < IDLE_STATES; i++)
+		registers.setProtected(Register_Address::Display_Power_Current, i, idle.getCurrent((Idle_State)i));
+
+	// the graph collects the samples either way, so it has a history the moment it is shown
+	int samples[GRAPH_SERIES] = { shownSample.voltage, shownSample.current, shownSample.power };
+	if(graph.push(samples) && pager.getCurrent() == PAGE_GRAPH)
+		pacer.request();
+
+	// hand the new values to the widgets of the page that is shown, they only change when the text they show changes
+	pager.update();
+
+	// the graph scrolls the display memory, the overlay would scroll along with it
+	overlay.setVisible(registers.getProtected(Register_Address::Display_Debug_Overlay) && pager.getCurrent() != PAGE_GRAPH);
+
+	// the latency benchmark wants the UI as busy as it gets
+	if(uiLoad)
+		redrawScreen();
+
+	if(root.isDirty())
+		pacer.request();
+
+	// leave the CPU and the SPI bus alone until there is something new to show
+	if(idle.getState() == IDLE_SLEEPING || !pacer.isDue())
+		return;
+
+	pacer.beginFrame();
+	screen.beginFrame();
+
+#ifdef DISP_STRIP_RENDERING
+	// the readout does not go through the frame buffer, the rows of the widgets that changed are rendered and streamed out band by band
+	if(pager.getCurrent() == PAGE_READOUT)
+	{
+		Screen_Rect area = {0, 0, 0, 0};
+		uiProfiler.mark(STAGE_TEXT);
+		if(root.collect(&area))
+		{
+			waitForScreen();
+			strip.render(area.y, area.height);
+		}
+		uiProfiler.mark(STAGE_OTHER);
+		pacer.endFrame();
+		updateTimingRegisters();
+		uiFrames = uiFrames + 1;
+		return;
+	}
+#endif
+
+	// the widgets that changed restore what is behind them and draw themselves again
+	uiProfiler.mark(STAGE_TEXT);
+	root.render(frameCanvas, &background, &screen);
+
+	// hand the parts that changed to the DMA, the last frame has to be out first
+	uiProfiler.mark(STAGE_DISPLAY);
+	waitForScreen();
+	screen.submit();
+	uiProfiler.mark(STAGE_OTHER);
+	pacer.endFrame();
+	updateTimingRegisters();
+	uiFrames = uiFrames + 1;
+}
+
+/**
+ * @brief Entry point of the UI core
+ * @note Sets up the display and everything drawn on it, then renders for good. Nothing else
+ * touches the frame buffer, PicoGFX included.
+*/
+void core1Main()
+{
+	// Initialize the display, the DMA interrupt of the screen goes to this core
+	spi.init();
+	display.init();
+	screen.init();
+	screen.setTransferBuffer(transferBuffer, DISP_TRANSFER_BUFFER_SIZE);
+	background.init();
+	background.setProfiler(&uiProfiler, STAGE_BACKGROUND);
+
+	backlight.init();
+
+	// create points for important locations
+	Point center = display.getCenter();
+
+#ifdef READOUT_FONT_ASSET
+	// the subset font only holds the readout glyphs and they are packed together, so draw them straight from flash
+	glyphCache.load(readout_font, READOUT_GLYPHS, false);
+#else
+	// the frame buffer is still free to use as scratch space
+	initGlyphs();
+#endif
+	picoGFX.getPrint().setColor(Colors::White);
+
+	// render the background once, the text is drawn on top of it from here on out. With the strips only the pages
+	// other than the readout restore it. The control core has to stay out of the flash while it is saved
+	kernels.setLinear(center.x, center.y, DISP_HEIGHT, BACKGROUND_ANGLE, BACKGROUND_FROM, BACKGROUND_TO);
+	kernels.linear(display.getFrameBuffer(), screenConfig.width, {0, 0, screenConfig.width, screenConfig.height});
+	controlLockout.request();
+	while(!controlLockout.isParked())
+		tight_loop_contents();
+	background.save();
+	controlLockout.release();
+
+	// the widgets are all marked as changed, so the first frame is drawn in its entirety
+	initWidgets();
+	strip.addLayer(stripBackground);
+	strip.addLayer(Widget::layer, &root);
+	graph.setColor(GRAPH_SERIES_VOLTAGE, GRAPH_COLOR_VOLTAGE);
+	graph.setColor(GRAPH_SERIES_CURRENT, GRAPH_COLOR_CURRENT);
+	graph.setColor(GRAPH_SERIES_POWER, GRAPH_COLOR_POWER);
+	graph.setInterval(GRAPH_INTERVAL);
+	resetStatistics();
+
+	uiScheduler.addTask(TASK_RENDER, renderTask, nullptr, TASK_RENDER_PERIOD, TASK_RENDER_PRIORITY);
+	// the control core might want the flash in the middle of a frame, or of a benchmark
+	Widget::setYield(yieldUI);
+	benchmark.setHook(benchmarkAlive);
+
+	// the backlight only comes on now that there is something to see
+	updateIdleTimeouts();
+	applyDisplayPower();
+
+	uiProfiler.init();
+	uiReady = true;
+
+	while(1)
+	{
+		if(uiProfiler.commit())
+			updateUIProfile();
+
+		uiScheduler.run();
+	}
+}
 
 /**
  * @brief Main function
- * @note This runs on the core 0
+ * @note This runs on the core 0, the control core. The display is left to core 1.
 */
 int main()
 {
@@ -322,9 +1689,8 @@ int main()
 	initLEDs();
 	fetchDataFromEEPROM();
 
-	// Initialize the display
-	spi.init();
-	display.init();
+	// the brightness stored in the EEPROM is the one to start with, an empty EEPROM reads as full brightness
+	registers.setProtected(Register_Address::Display_Brightness, MIN(backlightBrightness, BACKLIGHT_MAX_LEVEL));
 
 	// setup the ina219 current sensor
 	ina219.reset();
@@ -338,81 +1704,44 @@ int main()
 	ina219.setData();
 	ina219.getData(true);
 
-	// create points for important locations
-	Point cursor = Point(0, 0);
-	Point center = display.getCenter();
-	picoGFX.getPrint().setColor(Colors::White);
+	// let the host know why we booted
+	registers.setProtected(Register_Address::Device_Reset_Reason, supervisor.getResetReason());
+	registers.setProtected(Register_Address::Device_Stalled_Task, supervisor.getStalledTask());
 
-	// timer for the framerate calculation
-	int framecounter = 0;
-	int frames = 0;
-	unsigned long timer = 0;
+	// make the last trip available to the host
+	updateRecordRegisters();
 
-	// run the main loop
-	while(1)
+	// hand the display to the UI core, and get out of the flash whenever it saves the background
+	multicore_launch_core1_with_stack(core1Main, core1Stack, CORE1_STACK_SIZE);
+	while(!uiReady)
 	{
-		ina219.getData();	
-		processUSBData();
-		RegisterHandler();
-		buttonHandler();
-
-		// transfer the data from the INA219 to the registers for external access
-		registers.setProtected(Register_Address::Bus_Voltage, ina219.getBusVoltageRaw());
-		registers.setProtected(Register_Address::Shunt_Voltage, ina219.getShuntVoltage());
-		registers.setProtected(Register_Address::Current, ina219.getCurrentRaw());
-		registers.setProtected(Register_Address::Power, ina219.getPowerRaw());
-
-		// draw the background
-		picoGFX.getGradients().drawRotCircleGradient(center, DISP_HEIGHT, 10, Colors::OrangeRed, Colors::DarkYellow);
-		//picoGFX.getDisplay().fill(Colors::Derg);
-		//picoGFX.getGraphics().drawBitmap(background_image, 320, 172);
-
-		picoGFX.getPrint().setCursor(cursor);
-		picoGFX.getPrint().setFont(&RobotoMono48);
-		picoGFX.getPrint().setColor(Colors::White);
-
-		double voltage = ina219.getVoltage();
-		double current = ina219.getCurrent();
-		double power = ina219.getPower();
-
-		// draw the voltage
-		//picoGFX.getPrint().setCursor({0, 78});
-		getFormat(voltage, 'V');
-		picoGFX.getPrint().center(Alignment_t::HorizontalCenter);
-		picoGFX.getPrint().print();
+		if(controlLockout.isRequested())
+			controlLockout.park();
+	}
 
-		// draw the current
-		getFormat(current, 'A');
-		picoGFX.getPrint().center(Alignment_t::HorizontalCenter);
-		picoGFX.getPrint().print();
+	// schedule the tasks of the control core, the render task runs on the UI core
+	scheduler.addTask(TASK_SAMPLING, samplingTask, nullptr, TASK_SAMPLING_PERIOD, TASK_SAMPLING_PRIORITY);
+	scheduler.addTask(TASK_USB, usbTask, nullptr, TASK_USB_PERIOD, TASK_USB_PRIORITY);
+	scheduler.addTask(TASK_REGISTERS, registersTask, nullptr, TASK_REGISTERS_PERIOD, TASK_REGISTERS_PRIORITY);
+	scheduler.addTask(TASK_BUTTONS, buttonsTask, nullptr, TASK_BUTTONS_PERIOD, TASK_BUTTONS_PRIORITY);
 
-		// draw the power
-		picoGFX.getPrint().moveCursor(0, 10);
-		getFormat(power, 'W');
-		picoGFX.getPrint().center(Alignment_t::HorizontalCenter);
-		picoGFX.getPrint().print();
+	// supervise the tasks of both cores, the sampling task is the one feeding the watchdog
+	supervisor.addTask(TASK_SAMPLING, TASK_SAMPLING_TIMEOUT, true);
+	supervisor.addTask(TASK_USB, TASK_USB_TIMEOUT);
+	supervisor.addTask(TASK_REGISTERS, TASK_REGISTERS_TIMEOUT);
+	supervisor.addTask(TASK_BUTTONS, TASK_BUTTONS_TIMEOUT);
+	supervisor.addTask(TASK_RENDER, TASK_RENDER_TIMEOUT);
 
-		// draw the frame counter
-		picoGFX.getPrint().setCursor({230, 10});
-		picoGFX.getPrint().setColor(Colors::GreenYellow);
-		picoGFX.getPrint().setFont(&RobotoMono24);
-		picoGFX.getPrint().setString("%d fps", display.getFrameCounter());
-		picoGFX.getPrint().print();
+	supervisor.start();
+	profiler.init();
+
+	// run the tasks, the most urgent one that is due goes first and the core sleeps while none is
+	while(1)
+	{
+		// every pass of the scheduler ends here, the ones that only slept included
+		if(profiler.commit())
+			updateControlProfile();
 
-		// output the data to the display
-		display.update(true);
+		scheduler.run();
 	}
 }
-
-void getFormat(double value, char unit)
-{
-	// At 10 and above, we remove the decimal point
-	if(value >= 10.0f)
-		picoGFX.getPrint().setString("%.0f%c\n", value, unit);
-	// At 1 and above, we keep one decimal point
-	else if(value >= 1.0f)
-		picoGFX.getPrint().setString("%.1f%c\n", value, unit);
-	// Else we convert to milli and keep no decimal
-	else
-		picoGFX.getPrint().setString("%.0fm%c\n", value * 1000, unit);
-}
\ No newline at end of file